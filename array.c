@@ -26,6 +26,9 @@
 
 #include "awk.h"
 
+#include <math.h>
+#include "floatmagic.h"
+
 NODE *success_node;
 
 static size_t SUBSEPlen;
@@ -47,6 +50,7 @@ static const array_funcs_t null_array_func = {
 	null_afunc,
 	null_dump,
 	(afunc_t) 0,
+	NULL,
 };
 
 #define MAX_ATYPE 10
@@ -77,6 +81,8 @@ void
 array_init(void)
 {
 	(void) register_array_func(& str_array_func);	/* the default */
+	if (getenv("GAWK_FLAT_ARRAYS") != NULL)
+		(void) register_array_func(& flat_array_func);
 	if (! do_mpfr) {
 		(void) register_array_func(& int_array_func);
 		(void) register_array_func(& cint_array_func);
@@ -118,6 +124,40 @@ null_array(NODE *symbol)
 }
 
 
+/*
+ * array_order_type --- return the array type that PROCINFO["array_order"]
+ *	asks for, if any: "insertion" keeps the elements in the order they
+ *	were added, "sorted" keeps them in "@ind_str_asc" order.
+ */
+
+static const array_funcs_t *
+array_order_type(NODE *symbol)
+{
+	static NODE *array_order = NULL;
+	NODE *val;
+
+	if (PROCINFO_node == NULL || symbol == PROCINFO_node)
+		return NULL;
+
+	if (array_order == NULL)	/* do this once */
+		array_order = make_string("array_order", 11);
+
+	val = in_array(PROCINFO_node, array_order);
+	if (val == NULL || val->type != Node_val)
+		return NULL;
+
+	val = force_string(val);
+	if (val->stlen == 9 && memcmp(val->stptr, "insertion", 9) == 0)
+		return & order_array_func;
+	if (val->stlen == 6 && memcmp(val->stptr, "sorted", 6) == 0)
+		return & btree_array_func;
+	if (do_lint && val->stlen > 0)
+		lintwarn(_("PROCINFO[\"array_order\"]: unknown value `%.*s'"),
+			(int) val->stlen, val->stptr);
+	return NULL;
+}
+
+
 /* null_lookup --- assign type to an empty array. */
 
 static NODE **
@@ -128,6 +168,12 @@ null_lookup(NODE *symbol, NODE *subs)
 
 	assert(symbol->table_size == 0);
 
+	if ((afunc = array_order_type(symbol)) != NULL) {
+		/* an ordered array, whatever the subscripts */
+		symbol->array_funcs = afunc;
+		return symbol->alookup(symbol, subs);
+	}
+
 	/*
 	 * Check which array type wants to accept this sub; traverse
 	 * array type list in reverse order.
@@ -176,7 +222,7 @@ assoc_copy(NODE *symbol, NODE *newsymb)
 	assoc_clear(newsymb);
 	(void) symbol->acopy(symbol, newsymb);
 	newsymb->array_funcs = symbol->array_funcs;
-	newsymb->flags = symbol->flags;
+	newsymb->flags = symbol->flags & ~ARRAYITER;
 	return newsymb;
 }
 
@@ -191,6 +237,37 @@ assoc_dump(NODE *symbol, NODE *ndump)
 }
 
 
+/*
+ * xarray_iter --- step a for-in cursor through symbol->xarray, which cint
+ *	and int arrays list before their own elements. Returns NULL once the
+ *	xarray is done; the caller then goes on with its own elements.
+ */
+
+NODE *
+xarray_iter(NODE *symbol, NODE *cursor)
+{
+	NODE *xn, *xc, *subs;
+
+	if ((cursor->flags & XARRAY) != 0)
+		return NULL;
+
+	if ((xn = symbol->xarray) != NULL) {
+		if ((xc = cursor->for_xcursor) == NULL) {
+			getnode(xc);
+			clearnode(xc);
+			xc->type = Node_arrayfor;
+			cursor->for_xcursor = xc;
+		}
+		if ((subs = xn->aiter(xn, xc)) != NULL)
+			return subs;
+		freenode(xc);
+		cursor->for_xcursor = NULL;
+	}
+	cursor->flags |= XARRAY;
+	return NULL;
+}
+
+
 /* make_aname --- construct a 'vname' for a (sub)array */
 
 const char *
@@ -926,7 +1003,7 @@ asort_actual(nargs_t nargs, sort_context_t ctxt)
 				arr->vname = subs->stptr;
 				arr->vname[subs->stlen] = '\0';
 				subs->stptr = NULL;
-				subs->flags &= ~STRCUR;
+				subs->flags &= ~(STRCUR|HASHCUR);
 				arr->parent_array = array; /* actual parent, not the temporary one. */
 
 				value = assoc_copy(r, arr);
@@ -1297,6 +1374,286 @@ sort_user_func(const void *p1, const void *p2)
 }
 
 
+/*
+ * Radix sorting for the predefined sort orders.
+ *
+ * A large list is radix sorted on the number or the string the order
+ * is mainly about, and qsort() and the comparison function then sort
+ * each run of equal keys, which they mostly break on the index string.
+ * Numbers are sorted on their bit patterns, least significant byte
+ * first; strings with a multikey quicksort, one byte position at a time.
+ *
+ * MPFR numbers, IGNORECASE string comparisons and values that aren't
+ * scalars are left to qsort().
+ */
+
+#define RADIX_MIN	256	/* smaller lists go straight to qsort() */
+
+struct num_key {
+	uint64_t num;	/* the number, as an unsigned with the same order */
+	size_t pos;	/* element in the unsorted list */
+};
+
+struct str_key {
+	const unsigned char *str;
+	size_t len;
+	size_t pos;
+};
+
+/* double_key --- map a number to an unsigned ordered as by cmp_awknums() */
+
+static inline uint64_t
+double_key(AWKNUM d)
+{
+	uint64_t bits;
+
+	if (isnan(d))
+		return UINT64_MAX;	/* greater than anything else */
+	if (d == 0)
+		d = 0;		/* -0 and +0 are equal */
+	memcpy(& bits, & d, sizeof(bits));
+	if ((bits >> 63) != 0)
+		return ~bits;
+	return bits | ((uint64_t) 1 << 63);
+}
+
+/* sort_num_keys --- LSD radix sort, skipping the bytes all keys share */
+
+static void
+sort_num_keys(struct num_key *keys, size_t n)
+{
+	size_t count[8][256];
+	struct num_key *tmp, *src, *dst, *t;
+	size_t i, b, sum, c;
+	unsigned pass, shift;
+
+	memset(count, 0, sizeof(count));
+	for (i = 0; i < n; i++)
+		for (pass = 0; pass < 8; pass++)
+			count[pass][(keys[i].num >> (8 * pass)) & 0xFF]++;
+
+	emalloc(tmp, struct num_key *, n * sizeof(struct num_key), "sort_num_keys");
+	src = keys;
+	dst = tmp;
+	for (pass = 0; pass < 8; pass++) {
+		shift = 8 * pass;
+		if (count[pass][(src[0].num >> shift) & 0xFF] == n)
+			continue;
+		for (b = sum = 0; b < 256; b++) {
+			c = count[pass][b];
+			count[pass][b] = sum;
+			sum += c;
+		}
+		for (i = 0; i < n; i++)
+			dst[count[pass][(src[i].num >> shift) & 0xFF]++] = src[i];
+		t = src;
+		src = dst;
+		dst = t;
+	}
+	if (src != keys)
+		memcpy(keys, src, n * sizeof(struct num_key));
+	efree(tmp);
+}
+
+/* str_key_char --- byte at depth, -1 past the end so shorter sorts first */
+
+static inline int
+str_key_char(const struct str_key *k, size_t depth)
+{
+	return depth < k->len ? k->str[depth] : -1;
+}
+
+/* str_key_cmp --- compare keys with the same first depth bytes, as cmp_strings() */
+
+static int
+str_key_cmp(const struct str_key *k1, const struct str_key *k2, size_t depth)
+{
+	size_t len1 = k1->len - depth, len2 = k2->len - depth;
+	int ret;
+
+	ret = memcmp(k1->str + depth, k2->str + depth, len1 < len2 ? len1 : len2);
+	if (ret != 0 || len1 == len2)
+		return ret;
+	return len1 < len2 ? -1 : 1;
+}
+
+/* str_key_pos_cmp --- qsort comparison function; list order of keys */
+
+static int
+str_key_pos_cmp(const void *p1, const void *p2)
+{
+	const struct str_key *k1 = (const struct str_key *) p1;
+	const struct str_key *k2 = (const struct str_key *) p2;
+
+	return (k1->pos > k2->pos) - (k1->pos < k2->pos);
+}
+
+/* sort_str_keys --- multikey quicksort of keys with the same first depth bytes */
+
+static void
+sort_str_keys(struct str_key *keys, size_t n, size_t depth)
+{
+	struct str_key t;
+	struct {
+		struct str_key *keys;
+		size_t n, depth;
+	} part[3];
+	size_t lt, gt, i, j, big;
+	int v, v1, v2, v3, c;
+
+	while (n > 16) {
+		/* median of three for the pivot byte */
+		v1 = str_key_char(keys, depth);
+		v2 = str_key_char(keys + n / 2, depth);
+		v3 = str_key_char(keys + n - 1, depth);
+		if (v1 > v2) {
+			v = v1; v1 = v2; v2 = v;
+		}
+		v = v3 < v1 ? v1 : (v3 > v2 ? v2 : v3);
+
+		/* keys [0, lt) are less than the pivot, [gt, n) greater */
+		lt = i = 0;
+		gt = n;
+		while (i < gt) {
+			c = str_key_char(keys + i, depth);
+			if (c < v) {
+				t = keys[lt]; keys[lt++] = keys[i]; keys[i++] = t;
+			} else if (c > v) {
+				t = keys[--gt]; keys[gt] = keys[i]; keys[i] = t;
+			} else
+				i++;
+		}
+
+		part[0].keys = keys;
+		part[0].n = lt;
+		part[0].depth = depth;
+		part[1].keys = keys + lt;
+		part[1].n = (v < 0) ? 0 : gt - lt;	/* equal strings are done */
+		part[1].depth = depth + 1;
+		part[2].keys = keys + gt;
+		part[2].n = n - gt;
+		part[2].depth = depth;
+
+		/* recurse on the smaller parts, loop on the biggest */
+		big = 0;
+		for (i = 1; i < 3; i++)
+			if (part[i].n > part[big].n)
+				big = i;
+		for (i = 0; i < 3; i++)
+			if (i != big && part[i].n > 1)
+				sort_str_keys(part[i].keys, part[i].n, part[i].depth);
+		keys = part[big].keys;
+		n = part[big].n;
+		depth = part[big].depth;
+	}
+
+	/* insertion sort what's left */
+	for (i = 1; i < n; i++) {
+		t = keys[i];
+		for (j = i; j > 0 && str_key_cmp(keys + j - 1, & t, depth) > 0; j--)
+			keys[j] = keys[j - 1];
+		keys[j] = t;
+	}
+}
+
+/*
+ * radix_sort --- sort list by one of the predefined orders, given by its
+ *	sort_funcs kind; return false and leave list alone if it isn't a job
+ *	for radix sorting.
+ */
+
+static bool
+radix_sort(NODE **list, size_t num_elems, unsigned elem_size,
+	assoc_kind_t kind, int (*cmp_func)(const void *, const void *))
+{
+	struct num_key *nkeys = NULL;
+	struct str_key *skeys = NULL;
+	NODE **sorted, *r;
+	size_t nnum = 0, nstr = 0, i, j, k, run, out, start;
+	const size_t off = (kind & AVALUE) != 0 ? 1 : 0;
+	const bool desc = (kind & ADESC) != 0;
+
+	if (num_elems < RADIX_MIN)
+		return false;
+
+	/* count number and string keys */
+	for (i = 0; i < num_elems; i++) {
+		r = list[i * elem_size + off];
+		if (r->type != Node_val)
+			return false;
+		if ((kind & (AINUM|AVNUM)) != 0)
+			nnum++;
+		else if ((kind & (AISTR|AVSTR)) != 0)
+			nstr++;
+		else if ((fixtype(r)->flags & NUMBER) != 0)	/* @val_type */
+			nnum++;
+		else
+			nstr++;
+	}
+	if ((nnum > 0 && do_mpfr) || (nstr > 0 && IGNORECASE))
+		return false;
+
+	if (nnum > 0)
+		emalloc(nkeys, struct num_key *, nnum * sizeof(struct num_key), "radix_sort");
+	if (nstr > 0)
+		emalloc(skeys, struct str_key *, nstr * sizeof(struct str_key), "radix_sort");
+	for (i = j = k = 0; i < num_elems; i++) {
+		r = list[i * elem_size + off];
+		if ((kind & (AINUM|AVNUM)) != 0
+		    || ((kind & (AISTR|AVSTR)) == 0 && (r->flags & NUMBER) != 0)) {
+			nkeys[j].num = double_key(r->numbr);
+			nkeys[j++].pos = i;
+		} else {
+			skeys[k].str = (const unsigned char *) r->stptr;
+			skeys[k].len = r->stlen;
+			skeys[k++].pos = i;
+		}
+	}
+	if (nnum > 0)
+		sort_num_keys(nkeys, nnum);
+	if (nstr > 0)
+		sort_str_keys(skeys, nstr, 0);
+
+	/*
+	 * Numbers come before strings. Copy the elements in order, or in
+	 * reverse for a descending sort. A run of equal keys keeps the list
+	 * order, as it would with a stable qsort(), and cmp_func sorts it.
+	 */
+	emalloc(sorted, NODE **, num_elems * elem_size * sizeof(NODE *), "radix_sort");
+	for (i = 0, out = 0; i < nnum; i = j, out += run) {
+		for (j = i + 1; j < nnum && nkeys[j].num == nkeys[i].num; j++)
+			continue;
+		run = j - i;
+		start = desc ? num_elems - out - run : out;
+		for (k = 0; k < run; k++)
+			memcpy(sorted + (start + k) * elem_size,
+				list + nkeys[i + k].pos * elem_size, elem_size * sizeof(NODE *));
+		if (run > 1)
+			qsort(sorted + start * elem_size, run, elem_size * sizeof(NODE *), cmp_func);
+	}
+	for (i = 0; i < nstr; i = j, out += run) {
+		for (j = i + 1; j < nstr && str_key_cmp(skeys + j, skeys + i, 0) == 0; j++)
+			continue;
+		run = j - i;
+		start = desc ? num_elems - out - run : out;
+		if (run > 1)	/* the multikey quicksort isn't stable */
+			qsort(skeys + i, run, sizeof(struct str_key), str_key_pos_cmp);
+		for (k = 0; k < run; k++)
+			memcpy(sorted + (start + k) * elem_size,
+				list + skeys[i + k].pos * elem_size, elem_size * sizeof(NODE *));
+		if (run > 1)
+			qsort(sorted + start * elem_size, run, elem_size * sizeof(NODE *), cmp_func);
+	}
+	memcpy(list, sorted, num_elems * elem_size * sizeof(NODE *));
+	efree(sorted);
+	if (nkeys != NULL)
+		efree(nkeys);
+	if (skeys != NULL)
+		efree(skeys);
+	return true;
+}
+
+
 /* assoc_list -- construct, and optionally sort, a list of array elements */
 
 NODE **
@@ -1324,7 +1681,8 @@ assoc_list(NODE *symbol, const char *sort_str, sort_context_t sort_ctxt)
 
 	/*
 	 * N.B.: AASC and ADESC are hints to the specific array types.
-	 *	See cint_list() in cint_array.c.
+	 *	See cint_list() in cint_array.c and btree_list() in
+	 *	btree_array.c.
 	 */
 
 	NODE **list;
@@ -1334,6 +1692,7 @@ assoc_list(NODE *symbol, const char *sort_str, sort_context_t sort_ctxt)
 	INSTRUCTION *code = NULL;
 	enum defrule save_rule = UNKRULE; /* To silence the compiler.  */
 	assoc_kind_t assoc_kind = ANONE;
+	assoc_kind_t radix_kind = ANONE;	/* for radix_sort() */
 
 	elem_size = 1;
 
@@ -1344,9 +1703,10 @@ assoc_list(NODE *symbol, const char *sort_str, sort_context_t sort_ctxt)
 
 	if (qi < fsz) {
 		cmp_func = sort_funcs[qi].comp_func;
-		assoc_kind = sort_funcs[qi].kind;
+		assoc_kind = radix_kind = sort_funcs[qi].kind;
 
-		if (symbol->array_funcs != & cint_array_func)
+		if (   symbol->array_funcs != & cint_array_func
+		    && symbol->array_funcs != & btree_array_func)
 			assoc_kind &= ~(AASC|ADESC);
 
 		if (sort_ctxt != SORTED_IN || (assoc_kind & AVALUE) != 0) {
@@ -1406,7 +1766,9 @@ assoc_list(NODE *symbol, const char *sort_str, sort_context_t sort_ctxt)
 
 		num_elems = assoc_length(symbol);
 
-		qsort(list, num_elems, elem_size * sizeof(NODE *), cmp_func); /* shazzam! */
+		if (radix_kind == ANONE
+		    || ! radix_sort(list, num_elems, elem_size, radix_kind, cmp_func))
+			qsort(list, num_elems, elem_size * sizeof(NODE *), cmp_func); /* shazzam! */
 
 		if (sort_ctxt == SORTED_IN && (assoc_kind & (AINDEX|AVALUE)) == (AINDEX|AVALUE)) {
 			/* relocate all index nodes to the first half of the list. */
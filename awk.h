@@ -169,6 +169,9 @@ typedef struct Regexp {
 	struct dfa *dfareg;
 	bool has_meta;		/* re has meta chars so (probably) isn't simple string */
 	bool maybe_long;	/* re has meta chars that can match long text */
+	struct redfa *lite;	/* byte DFA that finds the match itself, if any */
+	char *literal;		/* the one string the re matches, if it's fixed */
+	size_t litlen;
 } Regexp;
 #define	RESTART(rp,s)	(rp)->regs.start[0]
 #define	REEND(rp,s)	(rp)->regs.end[0]
@@ -180,6 +183,7 @@ typedef struct Regexp {
 #define RE_NO_FLAGS	0	/* empty flags */
 #define RE_NEED_START	1	/* need to know start/end of match */
 #define RE_NO_BOL	2	/* not allowed to match ^ in regexp */
+#define RE_WHOLE_MATCH	4	/* only need start/end of the whole match, text is ASCII */
 
 #include "uni_char.h"
 
@@ -376,6 +380,8 @@ typedef struct {
 	afunc_t copy;
 	afunc_t dump;
 	afunc_t store;
+	/* next index for a for-in cursor, or NULL; see eval.c */
+	struct exp_node *(*iter)(struct exp_node *, struct exp_node *);
 } array_funcs_t;
 
 enum reflagvals {
@@ -459,6 +465,8 @@ enum flagvals {
 	XARRAY		= 0x10000,
 	NUMCONSTSTR	= 0x20000,	/* have string value for numeric constant */
 	REGEX           = 0x40000,	/* this is a typed regex */
+	HASHCUR		= 0x80000,	/* hash_code is that of the string value */
+	ARRAYITER	= 0x100000,	/* a for-in loop is streaming the indices */
 };
 
 /* Generally, a combination of enum flagvals,
@@ -486,6 +494,9 @@ typedef struct exp_node {
 				Regexp *preg[2];
 				struct exp_node **av;
 				BUCKET **bv;
+				struct flat_slot *fv;
+				struct order_entry *ov;
+				struct btree_node *btv;
 				void (*uptr)(void);
 				struct exp_instruction *iptr;
 			} r;
@@ -521,6 +532,7 @@ typedef struct exp_node {
 			uni_char_t *wsp;
 			size_t slen;
 			size_t wslen;
+			awk_ulong_t hc;
 			unsigned idx;
 			enum commenttype comtype;
 		} val;
@@ -577,6 +589,7 @@ typedef struct exp_node {
 #define strndmode sub.val.rndmode
 #define wstptr	sub.val.wsp		/* note: NUL-terminated! (but may contain NULs) */
 #define wstlen	sub.val.wslen
+#define hash_code	sub.val.hc	/* see node_hash_code() */
 #ifdef HAVE_MPFR
 #define mpg_numbr	sub.val.nm.mpnum
 #define mpg_i		sub.val.nm.mpi
@@ -601,6 +614,10 @@ typedef struct exp_node {
 #define for_list_size	sub.nodep.s.sz
 #define cur_list_idx	sub.nodep.l.lsz
 #define for_array 	sub.nodep.rn
+/* cursor of a streaming loop, whose for_list is NULL; see eval.c */
+#define for_pos		sub.nodep.reserved
+#define for_depth	sub.nodep.cnt
+#define for_xcursor	sub.nodep.x.extra	/* XARRAY in flags: done with it */
 
 /* Node_frame: */
 #define stack        sub.nodep.r.av
@@ -615,6 +632,9 @@ typedef struct exp_node {
 
 /* Node_var_array: */
 #define buckets		sub.nodep.r.bv
+#define flat_slots	sub.nodep.r.fv
+#define order_entries	sub.nodep.r.ov
+#define btree_root	sub.nodep.r.btv
 #define nodes		sub.nodep.r.av
 #define array_funcs	sub.nodep.l.lp
 #define array_base	sub.nodep.l.ulx
@@ -634,6 +654,7 @@ typedef struct exp_node {
 #define acopy		array_funcs->copy
 #define adump		array_funcs->dump
 #define astore		array_funcs->store
+#define aiter		array_funcs->iter
 
 /* Node_array_ref: */
 #define orig_array lnode
@@ -1028,11 +1049,29 @@ typedef struct exp_instruction {
 /* Op_store_var */
 #define initval         x.xn
 
+/* mapped input needs both the function and the header */
+#if defined(HAVE_MMAP) && ! defined(HAVE_SYS_MMAN_H)
+#undef HAVE_MMAP
+#endif
+
+/* input read-ahead uses POSIX threads */
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_PTHREAD_CREATE) \
+	&& ! defined(WINDOWS_NATIVE) && ! defined(__MINGW32__)
+#define USE_READAHEAD	1
+struct readahead;
+#endif
+
+/* the io_uring backend is Linux only */
+#if defined(HAVE_LINUX_IO_URING_H) && defined(HAVE_SYS_MMAN_H) && defined(__linux__)
+#define USE_IO_URING	1
+#endif
+
 enum iobuf_flags {
 	IOP_IS_TTY	= 1,
 	IOP_AT_EOF	= 2,
 	IOP_CLOSED	= 4,
 	IOP_AT_START	= 8,
+	IOP_MMAPPED	= 16,	/* buf is a window of a mapped regular file */
 };
 
 /* a combination of enum iobuf_flags */
@@ -1046,11 +1085,23 @@ typedef struct iobuf {
 	char *dataend;          /* first byte in buffer to hold new data,
 				   NULL if not read yet */
 	char *end;              /* end of buffer */
-	size_t readsize;        /* set from fstat call */
+	size_t readsize;        /* set from fstat call, grows while
+				   reads come back full */
+	size_t readmax;		/* limit for readsize */
+	size_t reclen;		/* fixed record length, 0 if RS is used */
 	size_t size;            /* buffer size */
 	ssize_t count;          /* amount read last time */
+	size_t nreads;		/* number of reads done */
+	int full_reads;		/* consecutive reads that filled the request */
 	size_t scanoff;         /* where we were in the buffer when we had
 				   to regrow/refill */
+#ifdef HAVE_MMAP
+	off_t mapoff;		/* file offset of buf, if IOP_MMAPPED */
+	size_t maplen;		/* bytes reserved at buf, if IOP_MMAPPED */
+#endif
+#ifdef USE_READAHEAD
+	struct readahead *readahead;	/* reader thread, if any */
+#endif
 	bool valid;
 	int errcode;
 
@@ -1088,8 +1139,13 @@ struct redirect {
 	int status;
 	struct redirect *prev;
 	struct redirect *next;
+	struct redirect *hnext;		/* hash chain, see red_find() */
+	struct redirect *lru_prev;	/* output files in order of use */
+	struct redirect *lru_next;
+	awk_ulong_t hcode;
 	const char *mode;
 	awk_output_buf_t output;
+	char *outbuf;	/* stdio buffer for PROCINFO["OUTPUT_BUFSIZE"], or NULL */
 };
 
 /* values for BINMODE, used as bit flags */
@@ -1247,12 +1303,17 @@ extern int (*cmp_numbers)(const NODE *, const NODE *);
 extern const array_funcs_t str_array_func;
 extern const array_funcs_t cint_array_func;
 extern const array_funcs_t int_array_func;
+extern const array_funcs_t flat_array_func;
+extern const array_funcs_t order_array_func;
+extern const array_funcs_t btree_array_func;
 
 /* special node used to indicate success in array routines (not NULL) */
 extern NODE *success_node;
 
 extern struct block_header nextfree[];
 extern bool field0_valid;
+extern field_num_t fields_wanted;
+extern bool field0_wanted;
 
 extern bool do_itrace;	/* separate so can poke from a debugger */
 
@@ -1275,6 +1336,7 @@ enum do_flag_values {
 	DO_PROFILE	   = 0x02000,	/* profile the program */
 	DO_DEBUG	   = 0x04000,	/* debug the program */
 	DO_MPFR		   = 0x08000,	/* arbitrary-precision floating-point math */
+	DO_CSV		   = 0x10000,	/* process comma-separated-value files */
 };
 
 /* a combination of enum do_flag_values */
@@ -1294,6 +1356,7 @@ extern do_flags_t do_flags;
 #define do_sandbox          (do_flags & DO_SANDBOX)
 #define do_debug            (do_flags & DO_DEBUG)
 #define do_mpfr             (do_flags & DO_MPFR)
+#define do_csv              (do_flags & DO_CSV)
 
 extern bool do_optimize;
 extern int use_lc_numeric;
@@ -1598,9 +1661,13 @@ extern unsigned fatal_tag_valid;
 #define assoc_length(a)	((a)->table_size)
 #define assoc_empty(a)	(!assoc_length(a))
 
+extern void snapshot_arrayfor(NODE *symbol);
+
 static inline NODE **
 assoc_lookup(NODE *arr, NODE *sub)
 {
+	if ((arr->flags & ARRAYITER) != 0 && arr->aexists(arr, sub) == NULL)
+		snapshot_arrayfor(arr);
 	return arr->alookup(arr, sub);
 }
 
@@ -1608,6 +1675,8 @@ assoc_lookup(NODE *arr, NODE *sub)
 static inline void
 assoc_clear(NODE *arr)
 {
+	if ((arr->flags & ARRAYITER) != 0)
+		snapshot_arrayfor(arr);
 	(void) arr->aclear(arr, NULL);
 }
 
@@ -1615,6 +1684,8 @@ assoc_clear(NODE *arr)
 static inline bool
 assoc_remove(NODE *arr, NODE *sub)
 {
+	if ((arr->flags & ARRAYITER) != 0)
+		snapshot_arrayfor(arr);
 	return arr->aremove(arr, sub) != NULL;
 }
 
@@ -1650,6 +1721,7 @@ extern void set_SUBSEP(void);
 extern NODE *concat_exp(nargs_t nargs, bool do_subsep);
 extern NODE *assoc_copy(NODE *symbol, NODE *newsymb);
 extern void assoc_dump(NODE *symbol, NODE *p);
+extern NODE *xarray_iter(NODE *symbol, NODE *cursor);
 extern NODE **assoc_list(NODE *symbol, const char *sort_str, sort_context_t sort_ctxt);
 extern void assoc_info(NODE *subs, NODE *val, NODE *p, const char *aname);
 extern void do_delete(NODE *symbol, size_t nsubs);
@@ -1862,10 +1934,13 @@ extern NODE *get_actual_argument(NODE *, size_t, bool);
 /* field.c */
 extern void init_fields(void);
 extern void set_record(const char *buf, size_t cnt, const awk_fieldwidth_info_t *);
+extern void set_record_in_place(char *buf, size_t cnt, const awk_fieldwidth_info_t *);
+extern void keep_record(void);
 extern void reset_record(void);
 extern void rebuild_record(void);
 extern void set_NF(void);
 extern NODE **get_field(field_num_t num, Func_ptr *assign);
+extern void count_fields(void);
 extern NODE *do_split(nargs_t nargs);
 extern NODE *do_patsplit(nargs_t nargs);
 extern void set_FS(void);
@@ -1879,6 +1954,7 @@ typedef enum {
 	Using_FS,
 	Using_FIELDWIDTHS,
 	Using_FPAT,
+	Using_CSV,
 	Using_API
 } field_sep_type;
 extern field_sep_type current_field_sep(void);
@@ -1995,6 +2071,15 @@ extern awk_long_t getenv_long(const char *name);
 extern void after_beginfile(IOBUF **cur);
 extern void set_current_namespace(const char *new_namespace);
 
+/* memscan.c */
+extern char *(*memscan_byte)(const char *s, int c, size_t n);
+extern char *(*memscan_str)(const char *s, size_t n, const char *str, size_t len);
+extern void (*memscan_map)(const char *s, size_t n, int c, bool white, uint64_t *map);
+extern bool memscan_vector;
+extern void memscan_setup(void);
+extern bool memscan_ascii(const char *s, size_t n);
+extern bool byte_in_mbchars(int c);
+
 /* mpfr.c */
 extern void set_PREC(void);
 extern void set_ROUNDMODE(void);
@@ -2142,6 +2227,26 @@ extern bool check_param_names(void);
 extern bool is_all_upper(const char *name);
 extern bool cmp_keyword(const char name[], const char keyword[], unsigned len);
 
+/* redfa.c */
+extern struct redfa *redfa_compile(const char *s, size_t len);
+extern bool redfa_search(struct redfa *d, const char *s, size_t len,
+		size_t *mstart, size_t *mend);
+extern void redfa_free(struct redfa *d);
+
+/* uring.c */
+#ifdef USE_IO_URING
+extern bool uring_init(void);
+extern ssize_t uring_read(fd_t fd, void *buf, size_t size);
+extern void uring_output(awk_output_buf_t *outbuf);
+extern void uring_flush_all(void);
+#endif
+
+/* cint_array.c */
+extern NODE **cint_slot(NODE *symbol, awk_ulong_t k);
+
+/* flat_array.c */
+extern AWKNUM flat_kilobytes(NODE *symbol);
+
 /* floatcomp.c */
 #ifdef HAVE_UINTMAX_T
 extern uintmax_t adjust_uint(uintmax_t n);
@@ -2154,6 +2259,7 @@ extern AWKNUM int_kilobytes(NODE *symbol);
 
 /* str_array.c */
 extern NODE **is_integer(NODE *symbol, NODE *subs);
+extern awk_ulong_t node_hash_code(NODE *subs);
 extern AWKNUM str_kilobytes(NODE *symbol);
 
 #ifdef HAVE_SYS_WAIT_H
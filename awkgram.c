@@ -153,6 +153,8 @@ static INSTRUCTION *mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTIO
 static INSTRUCTION *mk_getline(INSTRUCTION *op, INSTRUCTION *opt_var, INSTRUCTION *redir, enum redirval redirtype);
 static size_t count_expressions(INSTRUCTION **list, bool isarg);
 static INSTRUCTION *optimize_assignment(INSTRUCTION *exp);
+static void note_field_ref(INSTRUCTION *exp);
+static void note_field_assign(INSTRUCTION *lhs);
 static void add_lint(INSTRUCTION *list, LINTTYPE linttype);
 
 enum defref { FUNC_DEFINE, FUNC_USE, FUNC_EXT };
@@ -245,7 +247,7 @@ extern double fmod(double x, double y);
 
 #define YYSTYPE INSTRUCTION *
 
-#line 249 "awkgram.c"
+#line 251 "awkgram.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -882,27 +884,27 @@ static const yytype_int8 yytranslate[] =
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   245,   245,   246,   251,   261,   265,   277,   285,   299,
-     310,   321,   332,   345,   355,   357,   362,   372,   374,   379,
-     381,   383,   389,   393,   398,   428,   440,   452,   458,   467,
-     485,   486,   497,   503,   511,   512,   516,   516,   550,   549,
-     583,   598,   600,   605,   606,   626,   631,   632,   636,   647,
-     652,   659,   767,   818,   868,   994,  1016,  1037,  1047,  1057,
-    1067,  1078,  1091,  1109,  1108,  1125,  1143,  1143,  1245,  1245,
-    1278,  1308,  1316,  1317,  1323,  1324,  1331,  1336,  1349,  1364,
-    1366,  1374,  1381,  1383,  1391,  1400,  1402,  1411,  1412,  1420,
-    1425,  1425,  1438,  1445,  1458,  1462,  1484,  1485,  1491,  1492,
-    1501,  1502,  1507,  1512,  1529,  1531,  1533,  1540,  1541,  1547,
-    1548,  1553,  1555,  1562,  1564,  1572,  1577,  1588,  1589,  1594,
-    1596,  1603,  1605,  1613,  1618,  1628,  1629,  1634,  1635,  1640,
-    1647,  1651,  1653,  1655,  1668,  1685,  1695,  1702,  1704,  1709,
-    1711,  1713,  1721,  1723,  1728,  1730,  1735,  1737,  1739,  1796,
-    1798,  1800,  1802,  1804,  1806,  1808,  1810,  1824,  1829,  1834,
-    1865,  1871,  1873,  1875,  1877,  1879,  1881,  1886,  1890,  1922,
-    1930,  1936,  1942,  1955,  1956,  1957,  1962,  1967,  1971,  1975,
-    1990,  2011,  2016,  2053,  2090,  2091,  2097,  2098,  2103,  2105,
-    2112,  2129,  2146,  2148,  2155,  2160,  2166,  2177,  2189,  2198,
-    2202,  2207,  2211,  2215,  2219,  2224,  2225,  2229,  2233,  2237
+       0,   247,   247,   248,   253,   263,   267,   279,   287,   301,
+     312,   323,   334,   347,   357,   359,   364,   374,   376,   381,
+     383,   385,   391,   395,   400,   430,   442,   454,   460,   469,
+     487,   488,   499,   505,   513,   514,   518,   518,   552,   551,
+     586,   601,   603,   608,   609,   629,   634,   635,   639,   650,
+     655,   662,   770,   821,   871,   997,  1019,  1040,  1050,  1060,
+    1070,  1081,  1094,  1112,  1111,  1128,  1146,  1146,  1251,  1251,
+    1284,  1314,  1322,  1323,  1329,  1330,  1337,  1342,  1355,  1370,
+    1372,  1380,  1387,  1389,  1397,  1406,  1408,  1417,  1418,  1426,
+    1431,  1431,  1444,  1451,  1464,  1468,  1490,  1491,  1497,  1498,
+    1507,  1508,  1513,  1518,  1535,  1537,  1539,  1546,  1547,  1553,
+    1554,  1559,  1561,  1568,  1570,  1578,  1583,  1594,  1595,  1600,
+    1602,  1609,  1611,  1619,  1624,  1634,  1635,  1640,  1641,  1646,
+    1653,  1657,  1659,  1661,  1674,  1691,  1701,  1708,  1710,  1715,
+    1717,  1719,  1727,  1729,  1734,  1736,  1741,  1743,  1745,  1802,
+    1804,  1806,  1808,  1810,  1812,  1814,  1816,  1830,  1835,  1840,
+    1871,  1877,  1879,  1881,  1883,  1885,  1887,  1892,  1896,  1928,
+    1936,  1942,  1948,  1961,  1962,  1963,  1968,  1973,  1977,  1981,
+    1996,  2017,  2022,  2059,  2096,  2097,  2103,  2104,  2109,  2111,
+    2118,  2135,  2152,  2154,  2161,  2166,  2172,  2183,  2195,  2205,
+    2209,  2214,  2218,  2222,  2226,  2231,  2232,  2236,  2240,  2244
 };
 #endif
 
@@ -1904,22 +1906,22 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* program: %empty  */
-#line 245 "awkgram.y"
+#line 247 "awkgram.y"
           { yyval = NULL; }
-#line 1910 "awkgram.c"
+#line 1912 "awkgram.c"
     break;
 
   case 3: /* program: program rule  */
-#line 247 "awkgram.y"
+#line 249 "awkgram.y"
           {
 		rule = UNKRULE;
 		yyerrok;
 	  }
-#line 1919 "awkgram.c"
+#line 1921 "awkgram.c"
     break;
 
   case 4: /* program: program nls  */
-#line 252 "awkgram.y"
+#line 254 "awkgram.y"
           {
 		if (yyvsp[0] != NULL) {
 			if (yyvsp[-1] == NULL)
@@ -1929,19 +1931,19 @@ yyreduce:
 		}
 		yyval = yyvsp[-1];
 	  }
-#line 1933 "awkgram.c"
+#line 1935 "awkgram.c"
     break;
 
   case 5: /* program: program LEX_EOF  */
-#line 262 "awkgram.y"
+#line 264 "awkgram.y"
           {
 		next_sourcefile();
 	  }
-#line 1941 "awkgram.c"
+#line 1943 "awkgram.c"
     break;
 
   case 6: /* program: program error  */
-#line 266 "awkgram.y"
+#line 268 "awkgram.y"
           {
 		rule = UNKRULE;
 		/*
@@ -1950,11 +1952,11 @@ yyreduce:
 		 */
   		/* yyerrok; */
 	  }
-#line 1954 "awkgram.c"
+#line 1956 "awkgram.c"
     break;
 
   case 7: /* rule: pattern action  */
-#line 278 "awkgram.y"
+#line 280 "awkgram.y"
           {
 		(void) append_rule(yyvsp[-1], yyvsp[0]);
 		if (pending_comment != NULL) {
@@ -1962,11 +1964,11 @@ yyreduce:
 			pending_comment = NULL;
 		}
 	  }
-#line 1966 "awkgram.c"
+#line 1968 "awkgram.c"
     break;
 
   case 8: /* rule: pattern statement_term  */
-#line 286 "awkgram.y"
+#line 288 "awkgram.y"
           {
 		if (rule != Rule) {
 			msg(_("%s blocks must have an action part"), ruletab[rule]);
@@ -1980,11 +1982,11 @@ yyreduce:
 			(void) append_rule(yyvsp[-1], NULL);
 		}
 	  }
-#line 1984 "awkgram.c"
+#line 1986 "awkgram.c"
     break;
 
   case 9: /* rule: function_prologue action  */
-#line 300 "awkgram.y"
+#line 302 "awkgram.y"
           {
 		in_function = false;
 		(void) mk_function(yyvsp[-1], yyvsp[0]);
@@ -1995,11 +1997,11 @@ yyreduce:
 		}
 		yyerrok;
 	  }
-#line 1999 "awkgram.c"
+#line 2001 "awkgram.c"
     break;
 
   case 10: /* rule: '@' LEX_INCLUDE source statement_term  */
-#line 311 "awkgram.y"
+#line 313 "awkgram.y"
           {
 		want_source = false;
 		at_seen = false;
@@ -2010,11 +2012,11 @@ yyreduce:
 		}
 		yyerrok;
 	  }
-#line 2014 "awkgram.c"
+#line 2016 "awkgram.c"
     break;
 
   case 11: /* rule: '@' LEX_LOAD library statement_term  */
-#line 322 "awkgram.y"
+#line 324 "awkgram.y"
           {
 		want_source = false;
 		at_seen = false;
@@ -2025,11 +2027,11 @@ yyreduce:
 		}
 		yyerrok;
 	  }
-#line 2029 "awkgram.c"
+#line 2031 "awkgram.c"
     break;
 
   case 12: /* rule: '@' LEX_NAMESPACE namespace statement_term  */
-#line 333 "awkgram.y"
+#line 335 "awkgram.y"
           {
 		want_source = false;
 		at_seen = false;
@@ -2039,11 +2041,11 @@ yyreduce:
 
 		yyerrok;
 	  }
-#line 2043 "awkgram.c"
+#line 2045 "awkgram.c"
     break;
 
   case 13: /* source: FILENAME  */
-#line 346 "awkgram.y"
+#line 348 "awkgram.y"
           {
 		void *srcfile = NULL;
 
@@ -2053,23 +2055,23 @@ yyreduce:
 		bcfree(yyvsp[0]);
 		yyval = (INSTRUCTION *) srcfile;
 	  }
-#line 2057 "awkgram.c"
+#line 2059 "awkgram.c"
     break;
 
   case 14: /* source: FILENAME error  */
-#line 356 "awkgram.y"
+#line 358 "awkgram.y"
           { yyval = NULL; }
-#line 2063 "awkgram.c"
+#line 2065 "awkgram.c"
     break;
 
   case 15: /* source: error  */
-#line 358 "awkgram.y"
+#line 360 "awkgram.y"
           { yyval = NULL; }
-#line 2069 "awkgram.c"
+#line 2071 "awkgram.c"
     break;
 
   case 16: /* library: FILENAME  */
-#line 363 "awkgram.y"
+#line 365 "awkgram.y"
           {
 		void *srcfile;
 
@@ -2079,58 +2081,58 @@ yyreduce:
 		bcfree(yyvsp[0]);
 		yyval = (INSTRUCTION *) srcfile;
 	  }
-#line 2083 "awkgram.c"
+#line 2085 "awkgram.c"
     break;
 
   case 17: /* library: FILENAME error  */
-#line 373 "awkgram.y"
+#line 375 "awkgram.y"
           { yyval = NULL; }
-#line 2089 "awkgram.c"
+#line 2091 "awkgram.c"
     break;
 
   case 18: /* library: error  */
-#line 375 "awkgram.y"
+#line 377 "awkgram.y"
           { yyval = NULL; }
-#line 2095 "awkgram.c"
+#line 2097 "awkgram.c"
     break;
 
   case 19: /* namespace: FILENAME  */
-#line 380 "awkgram.y"
+#line 382 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 2101 "awkgram.c"
+#line 2103 "awkgram.c"
     break;
 
   case 20: /* namespace: FILENAME error  */
-#line 382 "awkgram.y"
+#line 384 "awkgram.y"
           { yyval = NULL; }
-#line 2107 "awkgram.c"
+#line 2109 "awkgram.c"
     break;
 
   case 21: /* namespace: error  */
-#line 384 "awkgram.y"
+#line 386 "awkgram.y"
           { yyval = NULL; }
-#line 2113 "awkgram.c"
+#line 2115 "awkgram.c"
     break;
 
   case 22: /* pattern: %empty  */
-#line 389 "awkgram.y"
+#line 391 "awkgram.y"
           {
 		rule = Rule;
 		yyval = NULL;
 	  }
-#line 2122 "awkgram.c"
+#line 2124 "awkgram.c"
     break;
 
   case 23: /* pattern: exp  */
-#line 394 "awkgram.y"
+#line 396 "awkgram.y"
           {
 		rule = Rule;
 	  }
-#line 2130 "awkgram.c"
+#line 2132 "awkgram.c"
     break;
 
   case 24: /* pattern: exp comma exp  */
-#line 399 "awkgram.y"
+#line 401 "awkgram.y"
           {
 		INSTRUCTION *tp;
 
@@ -2160,11 +2162,11 @@ yyreduce:
 			yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), tp);
 		rule = Rule;
 	  }
-#line 2164 "awkgram.c"
+#line 2166 "awkgram.c"
     break;
 
   case 25: /* pattern: LEX_BEGIN  */
-#line 429 "awkgram.y"
+#line 431 "awkgram.y"
           {
 		static int begin_seen = 0;
 
@@ -2176,11 +2178,11 @@ yyreduce:
 		yyvsp[0]->source_file = source;
 		yyval = yyvsp[0];
 	  }
-#line 2180 "awkgram.c"
+#line 2182 "awkgram.c"
     break;
 
   case 26: /* pattern: LEX_END  */
-#line 441 "awkgram.y"
+#line 443 "awkgram.y"
           {
 		static int end_seen = 0;
 
@@ -2192,31 +2194,31 @@ yyreduce:
 		yyvsp[0]->source_file = source;
 		yyval = yyvsp[0];
 	  }
-#line 2196 "awkgram.c"
+#line 2198 "awkgram.c"
     break;
 
   case 27: /* pattern: LEX_BEGINFILE  */
-#line 453 "awkgram.y"
+#line 455 "awkgram.y"
           {
 		yyvsp[0]->in_rule = rule = BEGINFILE;
 		yyvsp[0]->source_file = source;
 		yyval = yyvsp[0];
 	  }
-#line 2206 "awkgram.c"
+#line 2208 "awkgram.c"
     break;
 
   case 28: /* pattern: LEX_ENDFILE  */
-#line 459 "awkgram.y"
+#line 461 "awkgram.y"
           {
 		yyvsp[0]->in_rule = rule = ENDFILE;
 		yyvsp[0]->source_file = source;
 		yyval = yyvsp[0];
 	  }
-#line 2216 "awkgram.c"
+#line 2218 "awkgram.c"
     break;
 
   case 29: /* action: l_brace statements r_brace opt_semi opt_nls  */
-#line 468 "awkgram.y"
+#line 470 "awkgram.y"
           {
 		INSTRUCTION *ip = make_braced_statements(yyvsp[-4], yyvsp[-3], yyvsp[-2]);
 
@@ -2231,11 +2233,11 @@ yyreduce:
 
 		yyval = ip;
 	  }
-#line 2235 "awkgram.c"
+#line 2237 "awkgram.c"
     break;
 
   case 31: /* func_name: FUNC_CALL  */
-#line 487 "awkgram.y"
+#line 489 "awkgram.y"
           {
 		char *name = yyvsp[0]->lextok;
 		char *qname = qualify_name(name, strlen(name));
@@ -2246,36 +2248,36 @@ yyreduce:
 		}
 		yyval = yyvsp[0];
 	  }
-#line 2250 "awkgram.c"
+#line 2252 "awkgram.c"
     break;
 
   case 32: /* func_name: lex_builtin  */
-#line 498 "awkgram.y"
+#line 500 "awkgram.y"
           {
 		yyerror(_("`%s' is a built-in function, it cannot be redefined"),
 					tokstart);
 		YYABORT;
 	  }
-#line 2260 "awkgram.c"
+#line 2262 "awkgram.c"
     break;
 
   case 33: /* func_name: '@' LEX_EVAL  */
-#line 504 "awkgram.y"
+#line 506 "awkgram.y"
           {
 		yyval = yyvsp[0];
 		at_seen = false;
 	  }
-#line 2269 "awkgram.c"
+#line 2271 "awkgram.c"
     break;
 
   case 36: /* $@1: %empty  */
-#line 516 "awkgram.y"
+#line 518 "awkgram.y"
                                      { want_param_names = FUNC_HEADER; }
-#line 2275 "awkgram.c"
+#line 2277 "awkgram.c"
     break;
 
   case 37: /* function_prologue: LEX_FUNCTION func_name '(' $@1 opt_param_list r_paren opt_nls  */
-#line 517 "awkgram.y"
+#line 519 "awkgram.y"
           {
 		INSTRUCTION *func_comment = NULL;
 		// Merge any comments found in the parameter list with those
@@ -2301,17 +2303,17 @@ yyreduce:
 		yyval = yyvsp[-6];
 		want_param_names = FUNC_BODY;
 	  }
-#line 2305 "awkgram.c"
+#line 2307 "awkgram.c"
     break;
 
   case 38: /* $@2: %empty  */
-#line 550 "awkgram.y"
+#line 552 "awkgram.y"
                 { want_regexp = true; }
-#line 2311 "awkgram.c"
+#line 2313 "awkgram.c"
     break;
 
   case 39: /* regexp: a_slash $@2 REGEXP  */
-#line 552 "awkgram.y"
+#line 554 "awkgram.y"
                 {
 		  NODE *n, *exp;
 		  char *re;
@@ -2339,12 +2341,13 @@ yyreduce:
 		  yyval = yyvsp[0];
 		  yyval->opcode = Op_match_rec;
 		  yyval->memory = n;
+		  field0_wanted = true;
 		}
-#line 2344 "awkgram.c"
+#line 2347 "awkgram.c"
     break;
 
   case 40: /* typed_regexp: TYPED_REGEXP  */
-#line 584 "awkgram.y"
+#line 587 "awkgram.y"
                 {
 		  char *re;
 		  size_t len;
@@ -2357,23 +2360,23 @@ yyreduce:
 		  yyval->opcode = Op_push_re;
 		  yyval->memory = make_typed_regex(re, len);
 		}
-#line 2361 "awkgram.c"
+#line 2364 "awkgram.c"
     break;
 
   case 41: /* a_slash: '/'  */
-#line 599 "awkgram.y"
+#line 602 "awkgram.y"
           { bcfree(yyvsp[0]); }
-#line 2367 "awkgram.c"
+#line 2370 "awkgram.c"
     break;
 
   case 43: /* statements: %empty  */
-#line 605 "awkgram.y"
+#line 608 "awkgram.y"
           { yyval = NULL; }
-#line 2373 "awkgram.c"
+#line 2376 "awkgram.c"
     break;
 
   case 44: /* statements: statements statement  */
-#line 607 "awkgram.y"
+#line 610 "awkgram.y"
           {
 		if (yyvsp[0] == NULL) {
 			yyval = yyvsp[-1];
@@ -2393,29 +2396,29 @@ yyreduce:
 
 		yyerrok;
 	  }
-#line 2397 "awkgram.c"
+#line 2400 "awkgram.c"
     break;
 
   case 45: /* statements: statements error  */
-#line 627 "awkgram.y"
+#line 630 "awkgram.y"
           {	yyval = NULL; }
-#line 2403 "awkgram.c"
+#line 2406 "awkgram.c"
     break;
 
   case 46: /* statement_term: nls  */
-#line 631 "awkgram.y"
+#line 634 "awkgram.y"
                         { yyval = yyvsp[0]; }
-#line 2409 "awkgram.c"
+#line 2412 "awkgram.c"
     break;
 
   case 47: /* statement_term: semi opt_nls  */
-#line 632 "awkgram.y"
+#line 635 "awkgram.y"
                         { yyval = yyvsp[0]; }
-#line 2415 "awkgram.c"
+#line 2418 "awkgram.c"
     break;
 
   case 48: /* statement: semi opt_nls  */
-#line 637 "awkgram.y"
+#line 640 "awkgram.y"
           {
 		if (yyvsp[0] != NULL) {
 			INSTRUCTION *ip;
@@ -2426,31 +2429,31 @@ yyreduce:
 		} else
 			yyval = NULL;
 	  }
-#line 2430 "awkgram.c"
+#line 2433 "awkgram.c"
     break;
 
   case 49: /* statement: l_brace statements r_brace  */
-#line 648 "awkgram.y"
+#line 651 "awkgram.y"
           {
 		trailing_comment = yyvsp[0];	// NULL or comment
 		yyval = make_braced_statements(yyvsp[-2], yyvsp[-1], yyvsp[0]);
 	  }
-#line 2439 "awkgram.c"
+#line 2442 "awkgram.c"
     break;
 
   case 50: /* statement: if_statement  */
-#line 653 "awkgram.y"
+#line 656 "awkgram.y"
           {
 		if (do_pretty_print)
 			yyval = list_prepend(yyvsp[0], instruction(Op_exec_count));
 		else
 			yyval = yyvsp[0];
  	  }
-#line 2450 "awkgram.c"
+#line 2453 "awkgram.c"
     break;
 
   case 51: /* statement: LEX_SWITCH '(' exp r_paren opt_nls l_brace case_statements opt_nls r_brace  */
-#line 660 "awkgram.y"
+#line 663 "awkgram.y"
           {
 		INSTRUCTION *dflt, *curr = NULL, *cexp, *cstmt;
 		INSTRUCTION *ip, *nextc, *tbreak;
@@ -2558,11 +2561,11 @@ yyreduce:
 		break_allowed--;
 		fix_break_continue(ip, tbreak, NULL);
 	  }
-#line 2562 "awkgram.c"
+#line 2565 "awkgram.c"
     break;
 
   case 52: /* statement: LEX_WHILE '(' exp r_paren opt_nls statement  */
-#line 768 "awkgram.y"
+#line 771 "awkgram.y"
           {
 		/*
 		 *    -----------------
@@ -2613,11 +2616,11 @@ yyreduce:
 		continue_allowed--;
 		fix_break_continue(ip, tbreak, tcont);
 	  }
-#line 2617 "awkgram.c"
+#line 2620 "awkgram.c"
     break;
 
   case 53: /* statement: LEX_DO opt_nls statement LEX_WHILE '(' exp r_paren opt_nls  */
-#line 819 "awkgram.y"
+#line 822 "awkgram.y"
           {
 		/*
 		 *    -----------------
@@ -2667,11 +2670,11 @@ yyreduce:
 		/* else
 			$1 and $4 are NULLs */
 	  }
-#line 2671 "awkgram.c"
+#line 2674 "awkgram.c"
     break;
 
   case 54: /* statement: LEX_FOR '(' NAME LEX_IN simple_variable r_paren opt_nls statement  */
-#line 869 "awkgram.y"
+#line 872 "awkgram.y"
           {
 		INSTRUCTION *ip;
 		char *var_name = yyvsp[-5]->lextok;
@@ -2797,11 +2800,11 @@ regular_loop:
 		break_allowed--;
 		continue_allowed--;
 	  }
-#line 2801 "awkgram.c"
+#line 2804 "awkgram.c"
     break;
 
   case 55: /* statement: LEX_FOR '(' opt_simple_stmt semi opt_nls exp semi opt_nls opt_simple_stmt r_paren opt_nls statement  */
-#line 995 "awkgram.y"
+#line 998 "awkgram.y"
           {
 		if (yyvsp[-7] != NULL) {
 			merge_comments(yyvsp[-7], NULL);
@@ -2823,11 +2826,11 @@ regular_loop:
 		break_allowed--;
 		continue_allowed--;
 	  }
-#line 2827 "awkgram.c"
+#line 2830 "awkgram.c"
     break;
 
   case 56: /* statement: LEX_FOR '(' opt_simple_stmt semi opt_nls semi opt_nls opt_simple_stmt r_paren opt_nls statement  */
-#line 1017 "awkgram.y"
+#line 1020 "awkgram.y"
           {
 		if (yyvsp[-6] != NULL) {
 			merge_comments(yyvsp[-6], NULL);
@@ -2848,22 +2851,22 @@ regular_loop:
 		break_allowed--;
 		continue_allowed--;
 	  }
-#line 2852 "awkgram.c"
+#line 2855 "awkgram.c"
     break;
 
   case 57: /* statement: non_compound_stmt  */
-#line 1038 "awkgram.y"
+#line 1041 "awkgram.y"
           {
 		if (do_pretty_print)
 			yyval = list_prepend(yyvsp[0], instruction(Op_exec_count));
 		else
 			yyval = yyvsp[0];
 	  }
-#line 2863 "awkgram.c"
+#line 2866 "awkgram.c"
     break;
 
   case 58: /* non_compound_stmt: LEX_BREAK statement_term  */
-#line 1048 "awkgram.y"
+#line 1051 "awkgram.y"
           {
 		if (! break_allowed)
 			error_ln(yyvsp[-1]->source_line,
@@ -2873,11 +2876,11 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2877 "awkgram.c"
+#line 2880 "awkgram.c"
     break;
 
   case 59: /* non_compound_stmt: LEX_CONTINUE statement_term  */
-#line 1058 "awkgram.y"
+#line 1061 "awkgram.y"
           {
 		if (! continue_allowed)
 			error_ln(yyvsp[-1]->source_line,
@@ -2887,11 +2890,11 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2891 "awkgram.c"
+#line 2894 "awkgram.c"
     break;
 
   case 60: /* non_compound_stmt: LEX_NEXT statement_term  */
-#line 1068 "awkgram.y"
+#line 1071 "awkgram.y"
           {
 		/* if inside function (rule = 0), resolve context at run-time */
 		if (rule && rule != Rule)
@@ -2902,11 +2905,11 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2906 "awkgram.c"
+#line 2909 "awkgram.c"
     break;
 
   case 61: /* non_compound_stmt: LEX_NEXTFILE statement_term  */
-#line 1079 "awkgram.y"
+#line 1082 "awkgram.y"
           {
 		/* if inside function (rule = 0), resolve context at run-time */
 		if (rule == BEGIN || rule == END || rule == ENDFILE)
@@ -2919,11 +2922,11 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2923 "awkgram.c"
+#line 2926 "awkgram.c"
     break;
 
   case 62: /* non_compound_stmt: LEX_EXIT opt_exp statement_term  */
-#line 1092 "awkgram.y"
+#line 1095 "awkgram.y"
           {
 		/* Initialize the two possible jump targets, the actual target
 		 * is resolved at run-time.
@@ -2940,20 +2943,20 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2944 "awkgram.c"
+#line 2947 "awkgram.c"
     break;
 
   case 63: /* $@3: %empty  */
-#line 1109 "awkgram.y"
+#line 1112 "awkgram.y"
           {
 		if (! in_function)
 			yyerror(_("`return' used outside function context"));
 	  }
-#line 2953 "awkgram.c"
+#line 2956 "awkgram.c"
     break;
 
   case 64: /* non_compound_stmt: LEX_RETURN $@3 opt_fcall_exp statement_term  */
-#line 1112 "awkgram.y"
+#line 1115 "awkgram.y"
                                          {
 		if (called_from_eval)
 			yyvsp[-3]->opcode = Op_K_return_from_eval;
@@ -2967,28 +2970,28 @@ regular_loop:
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyval, yyvsp[0]);
 	  }
-#line 2971 "awkgram.c"
+#line 2974 "awkgram.c"
     break;
 
   case 65: /* non_compound_stmt: simple_stmt statement_term  */
-#line 1126 "awkgram.y"
+#line 1129 "awkgram.y"
           {
 		if (yyvsp[0] != NULL)
 			yyval = list_append(yyvsp[-1], yyvsp[0]);
 		else
 			yyval = yyvsp[-1];
 	  }
-#line 2982 "awkgram.c"
+#line 2985 "awkgram.c"
     break;
 
   case 66: /* $@4: %empty  */
-#line 1143 "awkgram.y"
+#line 1146 "awkgram.y"
                 { in_print = true; in_parens = 0; }
-#line 2988 "awkgram.c"
+#line 2991 "awkgram.c"
     break;
 
   case 67: /* simple_stmt: print $@4 print_expression_list output_redir  */
-#line 1144 "awkgram.y"
+#line 1147 "awkgram.y"
           {
 		/*
 		 * Optimization: plain `print' has no expression list, so $3 is null.
@@ -2996,6 +2999,9 @@ regular_loop:
 		 * which is faster for these two cases.
 		 */
 
+		if (yyvsp[-1] == NULL)
+			field0_wanted = true;	/* print, printf of $0 */
+
 		if (do_optimize && yyvsp[-3]->opcode == Op_K_print &&
 			(yyvsp[-1] == NULL
 				|| (yyvsp[-1]->lasti->opcode == Op_field_spec
@@ -3089,17 +3095,17 @@ regular_print:
 			}
 		}
 	  }
-#line 3093 "awkgram.c"
+#line 3099 "awkgram.c"
     break;
 
   case 68: /* $@5: %empty  */
-#line 1245 "awkgram.y"
+#line 1251 "awkgram.y"
                           { sub_counter = 0; }
-#line 3099 "awkgram.c"
+#line 3105 "awkgram.c"
     break;
 
   case 69: /* simple_stmt: LEX_DELETE NAME $@5 delete_subscript_list  */
-#line 1246 "awkgram.y"
+#line 1252 "awkgram.y"
           {
 		char *arr = yyvsp[-2]->lextok;
 
@@ -3132,11 +3138,11 @@ regular_print:
 			yyval = list_append(list_append(yyvsp[0], yyvsp[-2]), yyvsp[-3]);
 		}
 	  }
-#line 3136 "awkgram.c"
+#line 3142 "awkgram.c"
     break;
 
   case 70: /* simple_stmt: LEX_DELETE '(' NAME ')'  */
-#line 1283 "awkgram.y"
+#line 1289 "awkgram.y"
           {
 		static bool warned = false;
 		char *arr = yyvsp[-1]->lextok;
@@ -3162,54 +3168,54 @@ regular_print:
 				fatal(_("`delete' is not allowed with FUNCTAB"));
 		}
 	  }
-#line 3166 "awkgram.c"
+#line 3172 "awkgram.c"
     break;
 
   case 71: /* simple_stmt: exp  */
-#line 1309 "awkgram.y"
+#line 1315 "awkgram.y"
           {
 		yyval = optimize_assignment(yyvsp[0]);
 	  }
-#line 3174 "awkgram.c"
+#line 3180 "awkgram.c"
     break;
 
   case 72: /* opt_simple_stmt: %empty  */
-#line 1316 "awkgram.y"
+#line 1322 "awkgram.y"
           { yyval = NULL; }
-#line 3180 "awkgram.c"
+#line 3186 "awkgram.c"
     break;
 
   case 73: /* opt_simple_stmt: simple_stmt  */
-#line 1318 "awkgram.y"
+#line 1324 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3186 "awkgram.c"
+#line 3192 "awkgram.c"
     break;
 
   case 74: /* case_statements: %empty  */
-#line 1323 "awkgram.y"
+#line 1329 "awkgram.y"
           { yyval = NULL; }
-#line 3192 "awkgram.c"
+#line 3198 "awkgram.c"
     break;
 
   case 75: /* case_statements: case_statements case_statement  */
-#line 1325 "awkgram.y"
+#line 1331 "awkgram.y"
           {
 		if (yyvsp[-1] == NULL)
 			yyval = list_create(yyvsp[0]);
 		else
 			yyval = list_prepend(yyvsp[-1], yyvsp[0]);
 	  }
-#line 3203 "awkgram.c"
+#line 3209 "awkgram.c"
     break;
 
   case 76: /* case_statements: case_statements error  */
-#line 1332 "awkgram.y"
+#line 1338 "awkgram.y"
           { yyval = NULL; }
-#line 3209 "awkgram.c"
+#line 3215 "awkgram.c"
     break;
 
   case 77: /* case_statement: LEX_CASE case_value colon opt_nls statements  */
-#line 1337 "awkgram.y"
+#line 1343 "awkgram.y"
           {
 		INSTRUCTION *casestmt = yyvsp[0];
 		if (yyvsp[0] == NULL)
@@ -3222,11 +3228,11 @@ regular_print:
 		bcfree(yyvsp[-2]);
 		yyval = yyvsp[-4];
 	  }
-#line 3226 "awkgram.c"
+#line 3232 "awkgram.c"
     break;
 
   case 78: /* case_statement: LEX_DEFAULT colon opt_nls statements  */
-#line 1350 "awkgram.y"
+#line 1356 "awkgram.y"
           {
 		INSTRUCTION *casestmt = yyvsp[0];
 		if (yyvsp[0] == NULL)
@@ -3238,17 +3244,17 @@ regular_print:
 		yyvsp[-3]->comment = yyvsp[-1];
 		yyval = yyvsp[-3];
 	  }
-#line 3242 "awkgram.c"
+#line 3248 "awkgram.c"
     break;
 
   case 79: /* case_value: YNUMBER  */
-#line 1365 "awkgram.y"
+#line 1371 "awkgram.y"
           {	yyval = yyvsp[0]; }
-#line 3248 "awkgram.c"
+#line 3254 "awkgram.c"
     break;
 
   case 80: /* case_value: '-' YNUMBER  */
-#line 1367 "awkgram.y"
+#line 1373 "awkgram.y"
           {
 		NODE *n = yyvsp[0]->memory;
 		(void) force_number(n);
@@ -3256,28 +3262,28 @@ regular_print:
 		bcfree(yyvsp[-1]);
 		yyval = yyvsp[0];
 	  }
-#line 3260 "awkgram.c"
+#line 3266 "awkgram.c"
     break;
 
   case 81: /* case_value: '+' YNUMBER  */
-#line 1375 "awkgram.y"
+#line 1381 "awkgram.y"
           {
 		NODE *n = yyvsp[0]->lasti->memory;
 		bcfree(yyvsp[-1]);
 		add_sign_to_num(n, '+');
 		yyval = yyvsp[0];
 	  }
-#line 3271 "awkgram.c"
+#line 3277 "awkgram.c"
     break;
 
   case 82: /* case_value: YSTRING  */
-#line 1382 "awkgram.y"
+#line 1388 "awkgram.y"
           {	yyval = yyvsp[0]; }
-#line 3277 "awkgram.c"
+#line 3283 "awkgram.c"
     break;
 
   case 83: /* case_value: regexp  */
-#line 1384 "awkgram.y"
+#line 1390 "awkgram.y"
           {
 		if (yyvsp[0]->memory->type == Node_regex)
 			yyvsp[0]->opcode = Op_push_re;
@@ -3285,57 +3291,57 @@ regular_print:
 			yyvsp[0]->opcode = Op_push;
 		yyval = yyvsp[0];
 	  }
-#line 3289 "awkgram.c"
+#line 3295 "awkgram.c"
     break;
 
   case 84: /* case_value: typed_regexp  */
-#line 1392 "awkgram.y"
+#line 1398 "awkgram.y"
           {
 		assert((yyvsp[0]->memory->flags & REGEX) == REGEX);
 		yyvsp[0]->opcode = Op_push_re;
 		yyval = yyvsp[0];
 	  }
-#line 3299 "awkgram.c"
+#line 3305 "awkgram.c"
     break;
 
   case 85: /* print: LEX_PRINT  */
-#line 1401 "awkgram.y"
+#line 1407 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3305 "awkgram.c"
+#line 3311 "awkgram.c"
     break;
 
   case 86: /* print: LEX_PRINTF  */
-#line 1403 "awkgram.y"
+#line 1409 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3311 "awkgram.c"
+#line 3317 "awkgram.c"
     break;
 
   case 88: /* print_expression_list: '(' expression_list r_paren  */
-#line 1413 "awkgram.y"
+#line 1419 "awkgram.y"
           {
 		yyval = yyvsp[-1];
 	  }
-#line 3319 "awkgram.c"
+#line 3325 "awkgram.c"
     break;
 
   case 89: /* output_redir: %empty  */
-#line 1420 "awkgram.y"
+#line 1426 "awkgram.y"
           {
 		in_print = false;
 		in_parens = 0;
 		yyval = NULL;
 	  }
-#line 3329 "awkgram.c"
+#line 3335 "awkgram.c"
     break;
 
   case 90: /* $@6: %empty  */
-#line 1425 "awkgram.y"
+#line 1431 "awkgram.y"
                  { in_print = false; in_parens = 0; }
-#line 3335 "awkgram.c"
+#line 3341 "awkgram.c"
     break;
 
   case 91: /* output_redir: IO_OUT $@6 common_exp  */
-#line 1426 "awkgram.y"
+#line 1432 "awkgram.y"
           {
 		if (yyvsp[-2]->redir_type == redirect_twoway
 		    	&& yyvsp[0]->lasti->opcode == Op_K_getline_redir
@@ -3345,22 +3351,22 @@ regular_print:
 			lintwarn(_("concatenation as I/O `>' redirection target is ambiguous"));
 		yyval = list_prepend(yyvsp[0], yyvsp[-2]);
 	  }
-#line 3349 "awkgram.c"
+#line 3355 "awkgram.c"
     break;
 
   case 92: /* if_statement: LEX_IF '(' exp r_paren opt_nls statement  */
-#line 1439 "awkgram.y"
+#line 1445 "awkgram.y"
           {
 		if (yyvsp[-1] != NULL)
 			yyvsp[-5]->comment = yyvsp[-1];
 		add_lint(yyvsp[-3], LINT_assign_in_cond);
 		yyval = mk_condition(yyvsp[-3], yyvsp[-5], yyvsp[0], NULL, NULL);
 	  }
-#line 3360 "awkgram.c"
+#line 3366 "awkgram.c"
     break;
 
   case 93: /* if_statement: LEX_IF '(' exp r_paren opt_nls statement LEX_ELSE opt_nls statement  */
-#line 1447 "awkgram.y"
+#line 1453 "awkgram.y"
           {
 		if (yyvsp[-4] != NULL)
 			yyvsp[-8]->comment = yyvsp[-4];
@@ -3369,19 +3375,19 @@ regular_print:
 		add_lint(yyvsp[-6], LINT_assign_in_cond);
 		yyval = mk_condition(yyvsp[-6], yyvsp[-8], yyvsp[-3], yyvsp[-2], yyvsp[0]);
 	  }
-#line 3373 "awkgram.c"
+#line 3379 "awkgram.c"
     break;
 
   case 94: /* nls: NEWLINE  */
-#line 1459 "awkgram.y"
+#line 1465 "awkgram.y"
           {
 		yyval = yyvsp[0];
 	  }
-#line 3381 "awkgram.c"
+#line 3387 "awkgram.c"
     break;
 
   case 95: /* nls: nls NEWLINE  */
-#line 1463 "awkgram.y"
+#line 1469 "awkgram.y"
           {
 		if (yyvsp[-1] != NULL && yyvsp[0] != NULL) {
 			if (yyvsp[-1]->memory->comment_type == EOL_COMMENT) {
@@ -3399,59 +3405,59 @@ regular_print:
 		} else
 			yyval = NULL;
 	  }
-#line 3403 "awkgram.c"
+#line 3409 "awkgram.c"
     break;
 
   case 96: /* opt_nls: %empty  */
-#line 1484 "awkgram.y"
+#line 1490 "awkgram.y"
           { yyval = NULL; }
-#line 3409 "awkgram.c"
+#line 3415 "awkgram.c"
     break;
 
   case 97: /* opt_nls: nls  */
-#line 1486 "awkgram.y"
+#line 1492 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3415 "awkgram.c"
+#line 3421 "awkgram.c"
     break;
 
   case 98: /* input_redir: %empty  */
-#line 1491 "awkgram.y"
+#line 1497 "awkgram.y"
           { yyval = NULL; }
-#line 3421 "awkgram.c"
+#line 3427 "awkgram.c"
     break;
 
   case 99: /* input_redir: '<' simp_exp  */
-#line 1493 "awkgram.y"
+#line 1499 "awkgram.y"
           {
 		bcfree(yyvsp[-1]);
 		yyval = yyvsp[0];
 	  }
-#line 3430 "awkgram.c"
+#line 3436 "awkgram.c"
     break;
 
   case 100: /* opt_param_list: %empty  */
-#line 1501 "awkgram.y"
+#line 1507 "awkgram.y"
           { yyval = NULL; }
-#line 3436 "awkgram.c"
+#line 3442 "awkgram.c"
     break;
 
   case 101: /* opt_param_list: param_list  */
-#line 1503 "awkgram.y"
+#line 1509 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3442 "awkgram.c"
+#line 3448 "awkgram.c"
     break;
 
   case 102: /* param_list: NAME  */
-#line 1508 "awkgram.y"
+#line 1514 "awkgram.y"
           {
 		yyvsp[0]->param_count = 0;
 		yyval = list_create(yyvsp[0]);
 	  }
-#line 3451 "awkgram.c"
+#line 3457 "awkgram.c"
     break;
 
   case 103: /* param_list: param_list comma NAME  */
-#line 1513 "awkgram.y"
+#line 1519 "awkgram.y"
           {
 		if (yyvsp[-2] != NULL && yyvsp[0] != NULL) {
 			yyvsp[0]->param_count = yyvsp[-2]->lasti->param_count + 1;
@@ -3468,76 +3474,76 @@ regular_print:
 		} else
 			yyval = NULL;
 	  }
-#line 3472 "awkgram.c"
+#line 3478 "awkgram.c"
     break;
 
   case 104: /* param_list: error  */
-#line 1530 "awkgram.y"
+#line 1536 "awkgram.y"
           { yyval = NULL; }
-#line 3478 "awkgram.c"
+#line 3484 "awkgram.c"
     break;
 
   case 105: /* param_list: param_list error  */
-#line 1532 "awkgram.y"
+#line 1538 "awkgram.y"
           { yyval = yyvsp[-1]; }
-#line 3484 "awkgram.c"
+#line 3490 "awkgram.c"
     break;
 
   case 106: /* param_list: param_list comma error  */
-#line 1534 "awkgram.y"
+#line 1540 "awkgram.y"
           { yyval = yyvsp[-2]; }
-#line 3490 "awkgram.c"
+#line 3496 "awkgram.c"
     break;
 
   case 107: /* opt_exp: %empty  */
-#line 1540 "awkgram.y"
+#line 1546 "awkgram.y"
           { yyval = NULL; }
-#line 3496 "awkgram.c"
+#line 3502 "awkgram.c"
     break;
 
   case 108: /* opt_exp: exp  */
-#line 1542 "awkgram.y"
+#line 1548 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3502 "awkgram.c"
+#line 3508 "awkgram.c"
     break;
 
   case 109: /* opt_expression_list: %empty  */
-#line 1547 "awkgram.y"
+#line 1553 "awkgram.y"
           { yyval = NULL; }
-#line 3508 "awkgram.c"
+#line 3514 "awkgram.c"
     break;
 
   case 110: /* opt_expression_list: expression_list  */
-#line 1549 "awkgram.y"
+#line 1555 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3514 "awkgram.c"
+#line 3520 "awkgram.c"
     break;
 
   case 111: /* expression_list: exp  */
-#line 1554 "awkgram.y"
+#line 1560 "awkgram.y"
           {	yyval = mk_expression_list(NULL, yyvsp[0]); }
-#line 3520 "awkgram.c"
+#line 3526 "awkgram.c"
     break;
 
   case 112: /* expression_list: expression_list comma exp  */
-#line 1556 "awkgram.y"
+#line 1562 "awkgram.y"
           {
 		if (yyvsp[-1] != NULL)
 			yyvsp[-2]->lasti->comment = yyvsp[-1];
 		yyval = mk_expression_list(yyvsp[-2], yyvsp[0]);
 		yyerrok;
 	  }
-#line 3531 "awkgram.c"
+#line 3537 "awkgram.c"
     break;
 
   case 113: /* expression_list: error  */
-#line 1563 "awkgram.y"
+#line 1569 "awkgram.y"
           { yyval = NULL; }
-#line 3537 "awkgram.c"
+#line 3543 "awkgram.c"
     break;
 
   case 114: /* expression_list: expression_list error  */
-#line 1565 "awkgram.y"
+#line 1571 "awkgram.y"
           {
 		/*
 		 * Returning the expression list instead of NULL lets
@@ -3545,66 +3551,66 @@ regular_print:
 		 */
 		yyval = yyvsp[-1];
 	  }
-#line 3549 "awkgram.c"
+#line 3555 "awkgram.c"
     break;
 
   case 115: /* expression_list: expression_list error exp  */
-#line 1573 "awkgram.y"
+#line 1579 "awkgram.y"
           {
 		/* Ditto */
 		yyval = mk_expression_list(yyvsp[-2], yyvsp[0]);
 	  }
-#line 3558 "awkgram.c"
+#line 3564 "awkgram.c"
     break;
 
   case 116: /* expression_list: expression_list comma error  */
-#line 1578 "awkgram.y"
+#line 1584 "awkgram.y"
           {
 		/* Ditto */
 		if (yyvsp[-1] != NULL)
 			yyvsp[-2]->lasti->comment = yyvsp[-1];
 		yyval = yyvsp[-2];
 	  }
-#line 3569 "awkgram.c"
+#line 3575 "awkgram.c"
     break;
 
   case 117: /* opt_fcall_expression_list: %empty  */
-#line 1588 "awkgram.y"
+#line 1594 "awkgram.y"
           { yyval = NULL; }
-#line 3575 "awkgram.c"
+#line 3581 "awkgram.c"
     break;
 
   case 118: /* opt_fcall_expression_list: fcall_expression_list  */
-#line 1590 "awkgram.y"
+#line 1596 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3581 "awkgram.c"
+#line 3587 "awkgram.c"
     break;
 
   case 119: /* fcall_expression_list: fcall_exp  */
-#line 1595 "awkgram.y"
+#line 1601 "awkgram.y"
           {	yyval = mk_expression_list(NULL, yyvsp[0]); }
-#line 3587 "awkgram.c"
+#line 3593 "awkgram.c"
     break;
 
   case 120: /* fcall_expression_list: fcall_expression_list comma fcall_exp  */
-#line 1597 "awkgram.y"
+#line 1603 "awkgram.y"
           {
 		if (yyvsp[-1] != NULL)
 			yyvsp[-2]->lasti->comment = yyvsp[-1];
 		yyval = mk_expression_list(yyvsp[-2], yyvsp[0]);
 		yyerrok;
 	  }
-#line 3598 "awkgram.c"
+#line 3604 "awkgram.c"
     break;
 
   case 121: /* fcall_expression_list: error  */
-#line 1604 "awkgram.y"
+#line 1610 "awkgram.y"
           { yyval = NULL; }
-#line 3604 "awkgram.c"
+#line 3610 "awkgram.c"
     break;
 
   case 122: /* fcall_expression_list: fcall_expression_list error  */
-#line 1606 "awkgram.y"
+#line 1612 "awkgram.y"
           {
 		/*
 		 * Returning the expression list instead of NULL lets
@@ -3612,86 +3618,86 @@ regular_print:
 		 */
 		yyval = yyvsp[-1];
 	  }
-#line 3616 "awkgram.c"
+#line 3622 "awkgram.c"
     break;
 
   case 123: /* fcall_expression_list: fcall_expression_list error fcall_exp  */
-#line 1614 "awkgram.y"
+#line 1620 "awkgram.y"
           {
 		/* Ditto */
 		yyval = mk_expression_list(yyvsp[-2], yyvsp[0]);
 	  }
-#line 3625 "awkgram.c"
+#line 3631 "awkgram.c"
     break;
 
   case 124: /* fcall_expression_list: fcall_expression_list comma error  */
-#line 1619 "awkgram.y"
+#line 1625 "awkgram.y"
           {
 		/* Ditto */
 		if (yyvsp[-1] != NULL)
 			yyvsp[-2]->comment = yyvsp[-1];
 		yyval = yyvsp[-2];
 	  }
-#line 3636 "awkgram.c"
+#line 3642 "awkgram.c"
     break;
 
   case 125: /* fcall_exp: exp  */
-#line 1628 "awkgram.y"
+#line 1634 "awkgram.y"
               { yyval = yyvsp[0]; }
-#line 3642 "awkgram.c"
+#line 3648 "awkgram.c"
     break;
 
   case 126: /* fcall_exp: typed_regexp  */
-#line 1629 "awkgram.y"
+#line 1635 "awkgram.y"
                        { yyval = list_create(yyvsp[0]); }
-#line 3648 "awkgram.c"
+#line 3654 "awkgram.c"
     break;
 
   case 127: /* opt_fcall_exp: %empty  */
-#line 1634 "awkgram.y"
+#line 1640 "awkgram.y"
           { yyval = NULL; }
-#line 3654 "awkgram.c"
+#line 3660 "awkgram.c"
     break;
 
   case 128: /* opt_fcall_exp: fcall_exp  */
-#line 1635 "awkgram.y"
+#line 1641 "awkgram.y"
                     { yyval = yyvsp[0]; }
-#line 3660 "awkgram.c"
+#line 3666 "awkgram.c"
     break;
 
   case 129: /* exp: variable assign_operator exp  */
-#line 1641 "awkgram.y"
+#line 1647 "awkgram.y"
           {
 		if (do_lint && yyvsp[0]->lasti->opcode == Op_match_rec)
 			lintwarn_ln(yyvsp[-1]->source_line,
 				_("regular expression on right of assignment"));
 		yyval = mk_assignment(yyvsp[-2], yyvsp[0], yyvsp[-1]);
 	  }
-#line 3671 "awkgram.c"
+#line 3677 "awkgram.c"
     break;
 
   case 130: /* exp: variable ASSIGN typed_regexp  */
-#line 1648 "awkgram.y"
+#line 1654 "awkgram.y"
           {
 		yyval = mk_assignment(yyvsp[-2], list_create(yyvsp[0]), yyvsp[-1]);
 	  }
-#line 3679 "awkgram.c"
+#line 3685 "awkgram.c"
     break;
 
   case 131: /* exp: exp LEX_AND exp  */
-#line 1652 "awkgram.y"
+#line 1658 "awkgram.y"
           {	yyval = mk_boolean(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3685 "awkgram.c"
+#line 3691 "awkgram.c"
     break;
 
   case 132: /* exp: exp LEX_OR exp  */
-#line 1654 "awkgram.y"
+#line 1660 "awkgram.y"
           {	yyval = mk_boolean(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3691 "awkgram.c"
+#line 3697 "awkgram.c"
     break;
 
   case 133: /* exp: exp MATCHOP typed_regexp  */
-#line 1656 "awkgram.y"
+#line 1662 "awkgram.y"
           {
 		if (yyvsp[-2]->lasti->opcode == Op_match_rec)
 			warning_ln(yyvsp[-1]->source_line,
@@ -3704,11 +3710,11 @@ regular_print:
 		bcfree(yyvsp[0]);
 		yyval = list_append(yyvsp[-2], yyvsp[-1]);
 	  }
-#line 3708 "awkgram.c"
+#line 3714 "awkgram.c"
     break;
 
   case 134: /* exp: exp MATCHOP exp  */
-#line 1669 "awkgram.y"
+#line 1675 "awkgram.y"
           {
 		if (yyvsp[-2]->lasti->opcode == Op_match_rec)
 			warning_ln(yyvsp[-1]->source_line,
@@ -3725,11 +3731,11 @@ regular_print:
 			yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 		}
 	  }
-#line 3729 "awkgram.c"
+#line 3735 "awkgram.c"
     break;
 
   case 135: /* exp: exp LEX_IN simple_variable  */
-#line 1686 "awkgram.y"
+#line 1692 "awkgram.y"
           {
 		if (do_lint_old)
 			lintwarn_ln(yyvsp[-1]->source_line,
@@ -3739,91 +3745,91 @@ regular_print:
 		yyvsp[-1]->expr_count = 1;
 		yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 	  }
-#line 3743 "awkgram.c"
+#line 3749 "awkgram.c"
     break;
 
   case 136: /* exp: exp a_relop exp  */
-#line 1696 "awkgram.y"
+#line 1702 "awkgram.y"
           {
 		if (do_lint && yyvsp[0]->lasti->opcode == Op_match_rec)
 			lintwarn_ln(yyvsp[-1]->source_line,
 				_("regular expression on right of comparison"));
 		yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 	  }
-#line 3754 "awkgram.c"
+#line 3760 "awkgram.c"
     break;
 
   case 137: /* exp: exp '?' exp ':' exp  */
-#line 1703 "awkgram.y"
+#line 1709 "awkgram.y"
           { yyval = mk_condition(yyvsp[-4], yyvsp[-3], yyvsp[-2], yyvsp[-1], yyvsp[0]); }
-#line 3760 "awkgram.c"
+#line 3766 "awkgram.c"
     break;
 
   case 138: /* exp: common_exp  */
-#line 1705 "awkgram.y"
+#line 1711 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3766 "awkgram.c"
+#line 3772 "awkgram.c"
     break;
 
   case 139: /* assign_operator: ASSIGN  */
-#line 1710 "awkgram.y"
+#line 1716 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3772 "awkgram.c"
+#line 3778 "awkgram.c"
     break;
 
   case 140: /* assign_operator: ASSIGNOP  */
-#line 1712 "awkgram.y"
+#line 1718 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3778 "awkgram.c"
+#line 3784 "awkgram.c"
     break;
 
   case 141: /* assign_operator: SLASH_BEFORE_EQUAL ASSIGN  */
-#line 1714 "awkgram.y"
+#line 1720 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_assign_quotient;
 		yyval = yyvsp[0];
 	  }
-#line 3787 "awkgram.c"
+#line 3793 "awkgram.c"
     break;
 
   case 142: /* relop_or_less: RELOP  */
-#line 1722 "awkgram.y"
+#line 1728 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3793 "awkgram.c"
+#line 3799 "awkgram.c"
     break;
 
   case 143: /* relop_or_less: '<'  */
-#line 1724 "awkgram.y"
+#line 1730 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3799 "awkgram.c"
+#line 3805 "awkgram.c"
     break;
 
   case 144: /* a_relop: relop_or_less  */
-#line 1729 "awkgram.y"
+#line 1735 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3805 "awkgram.c"
+#line 3811 "awkgram.c"
     break;
 
   case 145: /* a_relop: '>'  */
-#line 1731 "awkgram.y"
+#line 1737 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3811 "awkgram.c"
+#line 3817 "awkgram.c"
     break;
 
   case 146: /* common_exp: simp_exp  */
-#line 1736 "awkgram.y"
+#line 1742 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3817 "awkgram.c"
+#line 3823 "awkgram.c"
     break;
 
   case 147: /* common_exp: simp_exp_nc  */
-#line 1738 "awkgram.y"
+#line 1744 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 3823 "awkgram.c"
+#line 3829 "awkgram.c"
     break;
 
   case 148: /* common_exp: common_exp simp_exp  */
-#line 1740 "awkgram.y"
+#line 1746 "awkgram.y"
           {
 		size_t count = 2;
 		bool is_simple_var = false;
@@ -3877,47 +3883,47 @@ regular_print:
 				max_args = count;
 		}
 	  }
-#line 3881 "awkgram.c"
+#line 3887 "awkgram.c"
     break;
 
   case 150: /* simp_exp: simp_exp '^' simp_exp  */
-#line 1799 "awkgram.y"
+#line 1805 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3887 "awkgram.c"
+#line 3893 "awkgram.c"
     break;
 
   case 151: /* simp_exp: simp_exp '*' simp_exp  */
-#line 1801 "awkgram.y"
+#line 1807 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3893 "awkgram.c"
+#line 3899 "awkgram.c"
     break;
 
   case 152: /* simp_exp: simp_exp '/' simp_exp  */
-#line 1803 "awkgram.y"
+#line 1809 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3899 "awkgram.c"
+#line 3905 "awkgram.c"
     break;
 
   case 153: /* simp_exp: simp_exp '%' simp_exp  */
-#line 1805 "awkgram.y"
+#line 1811 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3905 "awkgram.c"
+#line 3911 "awkgram.c"
     break;
 
   case 154: /* simp_exp: simp_exp '+' simp_exp  */
-#line 1807 "awkgram.y"
+#line 1813 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3911 "awkgram.c"
+#line 3917 "awkgram.c"
     break;
 
   case 155: /* simp_exp: simp_exp '-' simp_exp  */
-#line 1809 "awkgram.y"
+#line 1815 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3917 "awkgram.c"
+#line 3923 "awkgram.c"
     break;
 
   case 156: /* simp_exp: LEX_GETLINE opt_variable input_redir  */
-#line 1811 "awkgram.y"
+#line 1817 "awkgram.y"
           {
 		/*
 		 * In BEGINFILE/ENDFILE, allow `getline [var] < file'
@@ -3931,29 +3937,29 @@ regular_print:
 				_("non-redirected `getline' undefined inside END action"));
 		yyval = mk_getline(yyvsp[-2], yyvsp[-1], yyvsp[0], redirect_input);
 	  }
-#line 3935 "awkgram.c"
+#line 3941 "awkgram.c"
     break;
 
   case 157: /* simp_exp: variable INCREMENT  */
-#line 1825 "awkgram.y"
+#line 1831 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_postincrement;
 		yyval = mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
-#line 3944 "awkgram.c"
+#line 3950 "awkgram.c"
     break;
 
   case 158: /* simp_exp: variable DECREMENT  */
-#line 1830 "awkgram.y"
+#line 1836 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_postdecrement;
 		yyval = mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
-#line 3953 "awkgram.c"
+#line 3959 "awkgram.c"
     break;
 
   case 159: /* simp_exp: '(' expression_list r_paren LEX_IN simple_variable  */
-#line 1835 "awkgram.y"
+#line 1841 "awkgram.y"
           {
 		if (do_lint_old) {
 		    /* first one is warning so that second one comes out if warnings are fatal */
@@ -3979,64 +3985,64 @@ regular_print:
 			yyval = list_append(list_merge(t, yyvsp[0]), yyvsp[-1]);
 		}
 	  }
-#line 3983 "awkgram.c"
+#line 3989 "awkgram.c"
     break;
 
   case 160: /* simp_exp_nc: common_exp IO_IN LEX_GETLINE opt_variable  */
-#line 1866 "awkgram.y"
+#line 1872 "awkgram.y"
                 {
 		  yyval = mk_getline(yyvsp[-1], yyvsp[0], yyvsp[-3], yyvsp[-2]->redir_type);
 		  bcfree(yyvsp[-2]);
 		}
-#line 3992 "awkgram.c"
+#line 3998 "awkgram.c"
     break;
 
   case 161: /* simp_exp_nc: simp_exp_nc '^' simp_exp  */
-#line 1872 "awkgram.y"
+#line 1878 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 3998 "awkgram.c"
+#line 4004 "awkgram.c"
     break;
 
   case 162: /* simp_exp_nc: simp_exp_nc '*' simp_exp  */
-#line 1874 "awkgram.y"
+#line 1880 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 4004 "awkgram.c"
+#line 4010 "awkgram.c"
     break;
 
   case 163: /* simp_exp_nc: simp_exp_nc '/' simp_exp  */
-#line 1876 "awkgram.y"
+#line 1882 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 4010 "awkgram.c"
+#line 4016 "awkgram.c"
     break;
 
   case 164: /* simp_exp_nc: simp_exp_nc '%' simp_exp  */
-#line 1878 "awkgram.y"
+#line 1884 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 4016 "awkgram.c"
+#line 4022 "awkgram.c"
     break;
 
   case 165: /* simp_exp_nc: simp_exp_nc '+' simp_exp  */
-#line 1880 "awkgram.y"
+#line 1886 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 4022 "awkgram.c"
+#line 4028 "awkgram.c"
     break;
 
   case 166: /* simp_exp_nc: simp_exp_nc '-' simp_exp  */
-#line 1882 "awkgram.y"
+#line 1888 "awkgram.y"
           { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
-#line 4028 "awkgram.c"
+#line 4034 "awkgram.c"
     break;
 
   case 167: /* non_post_simp_exp: regexp  */
-#line 1887 "awkgram.y"
+#line 1893 "awkgram.y"
           {
 		yyval = list_create(yyvsp[0]);
 	  }
-#line 4036 "awkgram.c"
+#line 4042 "awkgram.c"
     break;
 
   case 168: /* non_post_simp_exp: '!' simp_exp  */
-#line 1891 "awkgram.y"
+#line 1897 "awkgram.y"
           {
 		if (yyvsp[0]->opcode == Op_match_rec) {
 			yyvsp[0]->opcode = Op_nomatch;
@@ -4068,11 +4074,11 @@ regular_print:
 			}
 		}
 	   }
-#line 4072 "awkgram.c"
+#line 4078 "awkgram.c"
     break;
 
   case 169: /* non_post_simp_exp: '(' exp r_paren  */
-#line 1923 "awkgram.y"
+#line 1929 "awkgram.y"
           {
 		// Always include. Allows us to lint warn on
 		// print "foo" > "bar" 1
@@ -4080,31 +4086,31 @@ regular_print:
 		// print "foo" > ("bar" 1)
 		yyval = list_append(yyvsp[-1], bcalloc(Op_parens, 1, sourceline));
 	  }
-#line 4084 "awkgram.c"
+#line 4090 "awkgram.c"
     break;
 
   case 170: /* non_post_simp_exp: LEX_BUILTIN '(' opt_fcall_expression_list r_paren  */
-#line 1931 "awkgram.y"
+#line 1937 "awkgram.y"
           {
 		yyval = snode(yyvsp[-1], yyvsp[-3]);
 		if (yyval == NULL)
 			YYABORT;
 	  }
-#line 4094 "awkgram.c"
+#line 4100 "awkgram.c"
     break;
 
   case 171: /* non_post_simp_exp: LEX_LENGTH '(' opt_fcall_expression_list r_paren  */
-#line 1937 "awkgram.y"
+#line 1943 "awkgram.y"
           {
 		yyval = snode(yyvsp[-1], yyvsp[-3]);
 		if (yyval == NULL)
 			YYABORT;
 	  }
-#line 4104 "awkgram.c"
+#line 4110 "awkgram.c"
     break;
 
   case 172: /* non_post_simp_exp: LEX_LENGTH  */
-#line 1943 "awkgram.y"
+#line 1949 "awkgram.y"
           {
 		static bool warned = false;
 
@@ -4117,45 +4123,45 @@ regular_print:
 		if (yyval == NULL)
 			YYABORT;
 	  }
-#line 4121 "awkgram.c"
+#line 4127 "awkgram.c"
     break;
 
   case 175: /* non_post_simp_exp: INCREMENT variable  */
-#line 1958 "awkgram.y"
+#line 1964 "awkgram.y"
           {
 		yyvsp[-1]->opcode = Op_preincrement;
 		yyval = mk_assignment(yyvsp[0], NULL, yyvsp[-1]);
 	  }
-#line 4130 "awkgram.c"
+#line 4136 "awkgram.c"
     break;
 
   case 176: /* non_post_simp_exp: DECREMENT variable  */
-#line 1963 "awkgram.y"
+#line 1969 "awkgram.y"
           {
 		yyvsp[-1]->opcode = Op_predecrement;
 		yyval = mk_assignment(yyvsp[0], NULL, yyvsp[-1]);
 	  }
-#line 4139 "awkgram.c"
+#line 4145 "awkgram.c"
     break;
 
   case 177: /* non_post_simp_exp: YNUMBER  */
-#line 1968 "awkgram.y"
+#line 1974 "awkgram.y"
           {
 		yyval = list_create(yyvsp[0]);
 	  }
-#line 4147 "awkgram.c"
+#line 4153 "awkgram.c"
     break;
 
   case 178: /* non_post_simp_exp: YSTRING  */
-#line 1972 "awkgram.y"
+#line 1978 "awkgram.y"
           {
 		yyval = list_create(yyvsp[0]);
 	  }
-#line 4155 "awkgram.c"
+#line 4161 "awkgram.c"
     break;
 
   case 179: /* non_post_simp_exp: '-' simp_exp  */
-#line 1976 "awkgram.y"
+#line 1982 "awkgram.y"
           {
 		if (yyvsp[0]->lasti->opcode == Op_push_i
 			&& (yyvsp[0]->lasti->memory->flags & STRING) == 0
@@ -4170,11 +4176,11 @@ regular_print:
 			yyval = list_append(yyvsp[0], yyvsp[-1]);
 		}
 	  }
-#line 4174 "awkgram.c"
+#line 4180 "awkgram.c"
     break;
 
   case 180: /* non_post_simp_exp: '+' simp_exp  */
-#line 1991 "awkgram.y"
+#line 1997 "awkgram.y"
           {
 		if (yyvsp[0]->lasti->opcode == Op_push_i
 			&& (yyvsp[0]->lasti->memory->flags & STRING) == 0
@@ -4192,20 +4198,20 @@ regular_print:
 			yyval = list_append(yyvsp[0], yyvsp[-1]);
 		}
 	  }
-#line 4196 "awkgram.c"
+#line 4202 "awkgram.c"
     break;
 
   case 181: /* func_call: direct_func_call  */
-#line 2012 "awkgram.y"
+#line 2018 "awkgram.y"
           {
 		func_use(yyvsp[0]->lasti->func_name, FUNC_USE);
 		yyval = yyvsp[0];
 	  }
-#line 4205 "awkgram.c"
+#line 4211 "awkgram.c"
     break;
 
   case 182: /* func_call: '@' direct_func_call  */
-#line 2017 "awkgram.y"
+#line 2023 "awkgram.y"
           {
 		/* indirect function call */
 		INSTRUCTION *f, *t;
@@ -4239,11 +4245,11 @@ regular_print:
 		yyval = list_prepend(yyvsp[0], t);
 		at_seen = false;
 	  }
-#line 4243 "awkgram.c"
+#line 4249 "awkgram.c"
     break;
 
   case 183: /* direct_func_call: FUNC_CALL '(' opt_fcall_expression_list r_paren  */
-#line 2054 "awkgram.y"
+#line 2060 "awkgram.y"
           {
 		NODE *n;
 		char *name = yyvsp[-3]->func_name;
@@ -4276,49 +4282,49 @@ regular_print:
 			yyval = list_append(t, yyvsp[-3]);
 		}
 	  }
-#line 4280 "awkgram.c"
+#line 4286 "awkgram.c"
     break;
 
   case 184: /* opt_variable: %empty  */
-#line 2090 "awkgram.y"
+#line 2096 "awkgram.y"
           { yyval = NULL; }
-#line 4286 "awkgram.c"
+#line 4292 "awkgram.c"
     break;
 
   case 185: /* opt_variable: variable  */
-#line 2092 "awkgram.y"
+#line 2098 "awkgram.y"
           { yyval = yyvsp[0]; }
-#line 4292 "awkgram.c"
+#line 4298 "awkgram.c"
     break;
 
   case 186: /* delete_subscript_list: %empty  */
-#line 2097 "awkgram.y"
+#line 2103 "awkgram.y"
           { yyval = NULL; }
-#line 4298 "awkgram.c"
+#line 4304 "awkgram.c"
     break;
 
   case 187: /* delete_subscript_list: delete_subscript SUBSCRIPT  */
-#line 2099 "awkgram.y"
+#line 2105 "awkgram.y"
           { yyval = yyvsp[-1]; }
-#line 4304 "awkgram.c"
+#line 4310 "awkgram.c"
     break;
 
   case 188: /* delete_subscript: delete_exp_list  */
-#line 2104 "awkgram.y"
+#line 2110 "awkgram.y"
           {	yyval = yyvsp[0]; }
-#line 4310 "awkgram.c"
+#line 4316 "awkgram.c"
     break;
 
   case 189: /* delete_subscript: delete_subscript delete_exp_list  */
-#line 2106 "awkgram.y"
+#line 2112 "awkgram.y"
           {
 		yyval = list_merge(yyvsp[-1], yyvsp[0]);
 	  }
-#line 4318 "awkgram.c"
+#line 4324 "awkgram.c"
     break;
 
   case 190: /* delete_exp_list: bracketed_exp_list  */
-#line 2113 "awkgram.y"
+#line 2119 "awkgram.y"
           {
 		INSTRUCTION *ip = yyvsp[0]->lasti;
 		const size_t count = ip->sub_count;	/* # of SUBSEP-seperated expressions */
@@ -4332,11 +4338,11 @@ regular_print:
 		sub_counter++;	/* count # of dimensions */
 		yyval = yyvsp[0];
 	  }
-#line 4336 "awkgram.c"
+#line 4342 "awkgram.c"
     break;
 
   case 191: /* bracketed_exp_list: '[' expression_list ']'  */
-#line 2130 "awkgram.y"
+#line 2136 "awkgram.y"
           {
 		INSTRUCTION *t = yyvsp[-1];
 		if (yyvsp[-1] == NULL) {
@@ -4350,41 +4356,41 @@ regular_print:
 			yyvsp[0]->sub_count = count_expressions(&t, false);
 		yyval = list_append(t, yyvsp[0]);
 	  }
-#line 4354 "awkgram.c"
+#line 4360 "awkgram.c"
     break;
 
   case 192: /* subscript: bracketed_exp_list  */
-#line 2147 "awkgram.y"
+#line 2153 "awkgram.y"
           {	yyval = yyvsp[0]; }
-#line 4360 "awkgram.c"
+#line 4366 "awkgram.c"
     break;
 
   case 193: /* subscript: subscript bracketed_exp_list  */
-#line 2149 "awkgram.y"
+#line 2155 "awkgram.y"
           {
 		yyval = list_merge(yyvsp[-1], yyvsp[0]);
 	  }
-#line 4368 "awkgram.c"
+#line 4374 "awkgram.c"
     break;
 
   case 194: /* subscript_list: subscript SUBSCRIPT  */
-#line 2156 "awkgram.y"
+#line 2162 "awkgram.y"
           { yyval = yyvsp[-1]; }
-#line 4374 "awkgram.c"
+#line 4380 "awkgram.c"
     break;
 
   case 195: /* simple_variable: NAME  */
-#line 2161 "awkgram.y"
+#line 2167 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_push;
 		yyvsp[0]->memory = variable(yyvsp[0]->source_line, yyvsp[0]->lextok, Node_var_new);
 		yyval = list_create(yyvsp[0]);
 	  }
-#line 4384 "awkgram.c"
+#line 4390 "awkgram.c"
     break;
 
   case 196: /* simple_variable: NAME subscript_list  */
-#line 2167 "awkgram.y"
+#line 2173 "awkgram.y"
           {
 		char *arr = yyvsp[-1]->lextok;
 
@@ -4392,11 +4398,11 @@ regular_print:
 		yyvsp[-1]->opcode = Op_push_array;
 		yyval = list_prepend(yyvsp[0], yyvsp[-1]);
 	  }
-#line 4396 "awkgram.c"
+#line 4402 "awkgram.c"
     break;
 
   case 197: /* variable: simple_variable  */
-#line 2178 "awkgram.y"
+#line 2184 "awkgram.y"
           {
 		INSTRUCTION *ip = yyvsp[0]->nexti;
 		if (ip->opcode == Op_push
@@ -4408,85 +4414,86 @@ regular_print:
 		} else
 			yyval = yyvsp[0];
 	  }
-#line 4412 "awkgram.c"
+#line 4418 "awkgram.c"
     break;
 
   case 198: /* variable: '$' non_post_simp_exp opt_incdec  */
-#line 2190 "awkgram.y"
+#line 2196 "awkgram.y"
           {
+		note_field_ref(yyvsp[-1]);
 		yyval = list_append(yyvsp[-1], yyvsp[-2]);
 		if (yyvsp[0] != NULL)
 			mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
-#line 4422 "awkgram.c"
+#line 4429 "awkgram.c"
     break;
 
   case 199: /* opt_incdec: INCREMENT  */
-#line 2199 "awkgram.y"
+#line 2206 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_postincrement;
 	  }
-#line 4430 "awkgram.c"
+#line 4437 "awkgram.c"
     break;
 
   case 200: /* opt_incdec: DECREMENT  */
-#line 2203 "awkgram.y"
+#line 2210 "awkgram.y"
           {
 		yyvsp[0]->opcode = Op_postdecrement;
 	  }
-#line 4438 "awkgram.c"
+#line 4445 "awkgram.c"
     break;
 
   case 201: /* opt_incdec: %empty  */
-#line 2207 "awkgram.y"
+#line 2214 "awkgram.y"
           { yyval = NULL; }
-#line 4444 "awkgram.c"
+#line 4451 "awkgram.c"
     break;
 
   case 202: /* l_brace: '{' opt_nls  */
-#line 2211 "awkgram.y"
+#line 2218 "awkgram.y"
                       { yyval = yyvsp[0]; }
-#line 4450 "awkgram.c"
+#line 4457 "awkgram.c"
     break;
 
   case 203: /* r_brace: '}' opt_nls  */
-#line 2215 "awkgram.y"
+#line 2222 "awkgram.y"
                         { yyval = yyvsp[0]; yyerrok; }
-#line 4456 "awkgram.c"
+#line 4463 "awkgram.c"
     break;
 
   case 204: /* r_paren: ')'  */
-#line 2219 "awkgram.y"
+#line 2226 "awkgram.y"
               { yyerrok; }
-#line 4462 "awkgram.c"
+#line 4469 "awkgram.c"
     break;
 
   case 205: /* opt_semi: %empty  */
-#line 2224 "awkgram.y"
+#line 2231 "awkgram.y"
           { yyval = NULL; }
-#line 4468 "awkgram.c"
+#line 4475 "awkgram.c"
     break;
 
   case 207: /* semi: ';'  */
-#line 2229 "awkgram.y"
+#line 2236 "awkgram.y"
                 { yyerrok; }
-#line 4474 "awkgram.c"
+#line 4481 "awkgram.c"
     break;
 
   case 208: /* colon: ':'  */
-#line 2233 "awkgram.y"
+#line 2240 "awkgram.y"
                 { yyval = yyvsp[0]; yyerrok; }
-#line 4480 "awkgram.c"
+#line 4487 "awkgram.c"
     break;
 
   case 209: /* comma: ',' opt_nls  */
-#line 2237 "awkgram.y"
+#line 2244 "awkgram.y"
                         { yyval = yyvsp[0]; yyerrok; }
-#line 4486 "awkgram.c"
+#line 4493 "awkgram.c"
     break;
 
 
-#line 4490 "awkgram.c"
+#line 4497 "awkgram.c"
 
       default: break;
     }
@@ -4680,7 +4687,7 @@ yyreturn:
   return yyresult;
 }
 
-#line 2239 "awkgram.y"
+#line 2246 "awkgram.y"
 
 
 struct token {
@@ -5255,6 +5262,12 @@ parse_program(INSTRUCTION **pcode, bool from_eval)
 	errcount = 0;
 	tok = tokstart != NULL ? tokstart : tokexpand();
 
+	/* the $n references in the program set these again */
+	if (! from_eval) {
+		fields_wanted = 0;
+		field0_wanted = (do_debug != 0);	/* the debugger can show $0 */
+	}
+
 	ret = yyparse();
 	*pcode = mk_program();
 
@@ -7065,6 +7078,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				expr->nexti->memory = set_profile_text(make_number(0.0), "0", 1);
 				(void) mk_expression_list(subn,
 						list_append(expr, instruction(Op_field_spec)));
+				field0_wanted = true;
 			}
 
 			arg = arg->lasti->nexti; 	/* third arg list */
@@ -7078,8 +7092,10 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				if (make_assignable(ip) == NULL)
 					yyerror(_("%s third parameter is not a changeable object"),
 						oper);
-				else
+				else {
 					ip->do_reference = true;
+					note_field_assign(arg);
+				}
 			}
 
 			r->expr_count = count_expressions(&subn, false);
@@ -7113,6 +7129,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				ip->memory = set_profile_text(make_number(0.0), "0", 1);
 				(void) mk_expression_list(subn,
 						list_append(list_create(ip), instruction(Op_field_spec)));
+				field0_wanted = true;
 			}
 
 			r->expr_count = count_expressions(&subn, false);
@@ -7140,6 +7157,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			(void) list_prepend(list, instruction(Op_field_spec));
 			(void) list_prepend(list, instruction(Op_push_i));
 			list->nexti->memory = set_profile_text(make_number(0.0), "0", 1);
+			field0_wanted = true;
 			return list;
 		} else {
 			arg = subn->nexti;
@@ -7822,6 +7840,61 @@ isnoeffect(OPCODE type)
 #endif /* NO_LINT */
 
 
+/*
+ * note_field_ref --- update fields_wanted and field0_wanted for $exp.
+ * Constant field numbers and $NF can be split on demand; anything else
+ * may need them all, or be $0.
+ */
+
+static void
+note_field_ref(INSTRUCTION *exp)
+{
+	INSTRUCTION *ip = exp->nexti;
+	NODE *n;
+
+	if (ip == exp->lasti && ip->opcode == Op_push_i) {
+		n = ip->memory;
+		if ((n->flags & (NUMBER|MPFN|MPZN)) == NUMBER
+				&& n->numbr >= 0 && n->numbr < 1000000
+				&& n->numbr == (field_num_t) n->numbr) {
+			if (n->numbr == 0)
+				field0_wanted = true;
+			else if (fields_wanted != F_UNLIMITED
+					&& (field_num_t) n->numbr > fields_wanted)
+				fields_wanted = (field_num_t) n->numbr;
+			return;
+		}
+	} else if (ip->opcode == Op_var_update && ip->nexti == exp->lasti
+			&& exp->lasti->opcode == Op_push
+			&& exp->lasti->memory == NF_node)
+		return;
+
+	fields_wanted = F_UNLIMITED;
+	field0_wanted = true;
+}
+
+/*
+ * note_field_assign --- assigning to a field other than $0 means
+ * rebuilding $0, which needs all the fields.
+ */
+
+static void
+note_field_assign(INSTRUCTION *lhs)
+{
+	INSTRUCTION *ip = lhs->nexti;
+
+	if (lhs->lasti->opcode != Op_field_spec
+			&& lhs->lasti->opcode != Op_field_spec_lhs)
+		return;
+
+	if (ip->opcode == Op_push_i && ip->nexti == lhs->lasti
+			&& (ip->memory->flags & (NUMBER|MPFN|MPZN)) == NUMBER
+			&& ip->memory->numbr == 0)
+		return;
+
+	fields_wanted = F_UNLIMITED;
+}
+
 /* make_assignable --- make this operand an assignable one if posiible */
 
 static INSTRUCTION *
@@ -8272,6 +8345,7 @@ mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTION *op)
 	tp = lhs->lasti;
 	switch (tp->opcode) {
 	case Op_field_spec:
+		note_field_assign(lhs);
 		tp->opcode = Op_field_spec_lhs;
 		break;
 	case Op_subscript:
@@ -8505,6 +8579,7 @@ mk_getline(INSTRUCTION *op, INSTRUCTION *var, INSTRUCTION *redir, enum redirval
 	}
 
 	if (var != NULL) {
+		note_field_assign(var);
 		tp = make_assignable(var->lasti);
 		assert(tp != NULL);
 
@@ -108,6 +108,8 @@ static INSTRUCTION *mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTIO
 static INSTRUCTION *mk_getline(INSTRUCTION *op, INSTRUCTION *opt_var, INSTRUCTION *redir, enum redirval redirtype);
 static size_t count_expressions(INSTRUCTION **list, bool isarg);
 static INSTRUCTION *optimize_assignment(INSTRUCTION *exp);
+static void note_field_ref(INSTRUCTION *exp);
+static void note_field_assign(INSTRUCTION *lhs);
 static void add_lint(INSTRUCTION *list, LINTTYPE linttype);
 
 enum defref { FUNC_DEFINE, FUNC_USE, FUNC_EXT };
@@ -576,6 +578,7 @@ regexp
 		  $$ = $3;
 		  $$->opcode = Op_match_rec;
 		  $$->memory = n;
+		  field0_wanted = true;
 		}
 	;
 
@@ -1148,6 +1151,9 @@ simple_stmt
 		 * which is faster for these two cases.
 		 */
 
+		if ($3 == NULL)
+			field0_wanted = true;	/* print, printf of $0 */
+
 		if (do_optimize && $1->opcode == Op_K_print &&
 			($3 == NULL
 				|| ($3->lasti->opcode == Op_field_spec
@@ -2188,6 +2194,7 @@ variable
 	  }
 	| '$' non_post_simp_exp opt_incdec
 	  {
+		note_field_ref($2);
 		$$ = list_append($2, $1);
 		if ($3 != NULL)
 			mk_assignment($2, NULL, $3);
@@ -2810,6 +2817,12 @@ parse_program(INSTRUCTION **pcode, bool from_eval)
 	errcount = 0;
 	tok = tokstart != NULL ? tokstart : tokexpand();
 
+	/* the $n references in the program set these again */
+	if (! from_eval) {
+		fields_wanted = 0;
+		field0_wanted = (do_debug != 0);	/* the debugger can show $0 */
+	}
+
 	ret = yyparse();
 	*pcode = mk_program();
 
@@ -4620,6 +4633,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				expr->nexti->memory = set_profile_text(make_number(0.0), "0", 1);
 				(void) mk_expression_list(subn,
 						list_append(expr, instruction(Op_field_spec)));
+				field0_wanted = true;
 			}
 
 			arg = arg->lasti->nexti; 	/* third arg list */
@@ -4633,8 +4647,10 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				if (make_assignable(ip) == NULL)
 					yyerror(_("%s third parameter is not a changeable object"),
 						oper);
-				else
+				else {
 					ip->do_reference = true;
+					note_field_assign(arg);
+				}
 			}
 
 			r->expr_count = count_expressions(&subn, false);
@@ -4668,6 +4684,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				ip->memory = set_profile_text(make_number(0.0), "0", 1);
 				(void) mk_expression_list(subn,
 						list_append(list_create(ip), instruction(Op_field_spec)));
+				field0_wanted = true;
 			}
 
 			r->expr_count = count_expressions(&subn, false);
@@ -4695,6 +4712,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			(void) list_prepend(list, instruction(Op_field_spec));
 			(void) list_prepend(list, instruction(Op_push_i));
 			list->nexti->memory = set_profile_text(make_number(0.0), "0", 1);
+			field0_wanted = true;
 			return list;
 		} else {
 			arg = subn->nexti;
@@ -5377,6 +5395,61 @@ isnoeffect(OPCODE type)
 #endif /* NO_LINT */
 
 
+/*
+ * note_field_ref --- update fields_wanted and field0_wanted for $exp.
+ * Constant field numbers and $NF can be split on demand; anything else
+ * may need them all, or be $0.
+ */
+
+static void
+note_field_ref(INSTRUCTION *exp)
+{
+	INSTRUCTION *ip = exp->nexti;
+	NODE *n;
+
+	if (ip == exp->lasti && ip->opcode == Op_push_i) {
+		n = ip->memory;
+		if ((n->flags & (NUMBER|MPFN|MPZN)) == NUMBER
+				&& n->numbr >= 0 && n->numbr < 1000000
+				&& n->numbr == (field_num_t) n->numbr) {
+			if (n->numbr == 0)
+				field0_wanted = true;
+			else if (fields_wanted != F_UNLIMITED
+					&& (field_num_t) n->numbr > fields_wanted)
+				fields_wanted = (field_num_t) n->numbr;
+			return;
+		}
+	} else if (ip->opcode == Op_var_update && ip->nexti == exp->lasti
+			&& exp->lasti->opcode == Op_push
+			&& exp->lasti->memory == NF_node)
+		return;
+
+	fields_wanted = F_UNLIMITED;
+	field0_wanted = true;
+}
+
+/*
+ * note_field_assign --- assigning to a field other than $0 means
+ * rebuilding $0, which needs all the fields.
+ */
+
+static void
+note_field_assign(INSTRUCTION *lhs)
+{
+	INSTRUCTION *ip = lhs->nexti;
+
+	if (lhs->lasti->opcode != Op_field_spec
+			&& lhs->lasti->opcode != Op_field_spec_lhs)
+		return;
+
+	if (ip->opcode == Op_push_i && ip->nexti == lhs->lasti
+			&& (ip->memory->flags & (NUMBER|MPFN|MPZN)) == NUMBER
+			&& ip->memory->numbr == 0)
+		return;
+
+	fields_wanted = F_UNLIMITED;
+}
+
 /* make_assignable --- make this operand an assignable one if posiible */
 
 static INSTRUCTION *
@@ -5827,6 +5900,7 @@ mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTION *op)
 	tp = lhs->lasti;
 	switch (tp->opcode) {
 	case Op_field_spec:
+		note_field_assign(lhs);
 		tp->opcode = Op_field_spec_lhs;
 		break;
 	case Op_subscript:
@@ -6060,6 +6134,7 @@ mk_getline(INSTRUCTION *op, INSTRUCTION *var, INSTRUCTION *redir, enum redirval
 	}
 
 	if (var != NULL) {
+		note_field_assign(var);
 		tp = make_assignable(var->lasti);
 		assert(tp != NULL);
 